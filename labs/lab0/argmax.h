@@ -0,0 +1,259 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ARGMAX_H
+#define STRUCTURES_ARGMAX_H
+
+#include <cstdint>  // std::int32_t, std::int64_t
+#include <cstring>  // std::memcpy
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::conditional, std::is_floating_point
+
+namespace structures {
+
+//! menor e maior valor de um vetor e as suas posicoes
+template<typename T>
+struct MinMaxPos {
+    T min;
+    std::size_t min_pos;
+    T max;
+    std::size_t max_pos;
+};
+
+/*
+    Posição do maior/menor elemento de v[0, n), para int32, int64, float e
+    double. Empates ficam com a primeira ocorrência. Em float/double, NaN é
+    ignorado (só é escolhido se todos forem NaN, e então a posição é 0).
+    n == 0 lança std::out_of_range.
+
+    O laço principal mantém em cada pista do vetor SIMD o maior valor visto
+    e a sua posição, trocando os dois com uma comparação e duas misturas,
+    sem desvios; no fim, entre as pistas com o maior valor vale a de menor
+    posição. A versão (AVX-512, AVX2 ou a largura básica de 16 bytes) é
+    escolhida na primeira chamada conforme o processador; compiladores sem
+    vetores do GCC/Clang usam o laço escalar.
+*/
+
+//! posicao do primeiro maior elemento de v[0, n)
+template<typename T>
+std::size_t argmax(const T* v, std::size_t n);
+//! posicao do primeiro menor elemento de v[0, n)
+template<typename T>
+std::size_t argmin(const T* v, std::size_t n);
+//! menor e maior elementos de v[0, n), numa passada so
+template<typename T>
+MinMaxPos<T> minmax_pos(const T* v, std::size_t n);
+
+namespace detail {
+
+#if defined(__GNUC__)
+#define STRUCTURES_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define STRUCTURES_ALWAYS_INLINE inline
+#endif
+
+//! conjunto de instrucoes usado pelos kernels
+enum class SimdLevel {
+    SCALAR,
+    BASELINE,
+    AVX2,
+    AVX512
+};
+
+//! melhor nivel suportado pelo processador (calculado uma vez)
+inline SimdLevel simd_level() {
+    static const SimdLevel level = [] {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return SimdLevel::AVX2;
+        }
+        return SimdLevel::BASELINE;
+#elif defined(__GNUC__)
+        return SimdLevel::BASELINE;
+#else
+        return SimdLevel::SCALAR;
+#endif
+    }();
+    return level;
+}
+
+//! acrescenta v[begin, n) ao resultado 'r' (posicoes maiores que as de 'r')
+template<typename T, bool Min, bool Max>
+STRUCTURES_ALWAYS_INLINE void extremes_tail(const T* v, std::size_t begin,
+                                            std::size_t n, MinMaxPos<T>& r) {
+    for (std::size_t i = begin; i < n; i++) {
+        if (Min && v[i] < r.min) {
+            r.min = v[i];
+            r.min_pos = i;
+        }
+        if (Max && v[i] > r.max) {
+            r.max = v[i];
+            r.max_pos = i;
+        }
+    }
+}
+
+#if defined(__GNUC__)
+//! kernel de W pistas sobre v[0, n), n < 2^30, partindo dos extremos 'lo'
+//! e 'hi' ja vistos (nao NaN): valores iguais a eles nao trocam a posicao 0
+template<typename T, int W, bool Min, bool Max>
+STRUCTURES_ALWAYS_INLINE MinMaxPos<T> extremes_block(const T* v,
+                                                     std::size_t n,
+                                                     T lo_seed, T hi_seed) {
+    using I = typename std::conditional<sizeof(T) == 4, std::int32_t,
+                                        std::int64_t>::type;
+    typedef T Values __attribute__((vector_size(sizeof(T) * W)));
+    typedef I Indices __attribute__((vector_size(sizeof(I) * W)));
+
+    Values lo, hi;
+    Indices lo_pos, hi_pos, positions;
+    for (int lane = 0; lane < W; lane++) {
+        lo[lane] = lo_seed;
+        hi[lane] = hi_seed;
+        lo_pos[lane] = 0;
+        hi_pos[lane] = 0;
+        positions[lane] = lane;
+    }
+    Indices step = positions - positions + W;
+    std::size_t i = 0;
+    for (; i + W <= n; i += W) {
+        Values x;
+        std::memcpy(&x, v + i, sizeof(x));
+        if (Min) {
+            Indices less = x < lo;
+            lo = less ? x : lo;
+            lo_pos = less ? positions : lo_pos;
+        }
+        if (Max) {
+            Indices greater = x > hi;
+            hi = greater ? x : hi;
+            hi_pos = greater ? positions : hi_pos;
+        }
+        positions += step;
+    }
+    // entre pistas empatadas vale a menor posicao
+    MinMaxPos<T> r = {lo[0], static_cast<std::size_t>(lo_pos[0]),
+                      hi[0], static_cast<std::size_t>(hi_pos[0])};
+    for (int lane = 1; lane < W; lane++) {
+        std::size_t lp = static_cast<std::size_t>(lo_pos[lane]);
+        std::size_t hp = static_cast<std::size_t>(hi_pos[lane]);
+        if (lo[lane] < r.min || (lo[lane] == r.min && lp < r.min_pos)) {
+            r.min = lo[lane];
+            r.min_pos = lp;
+        }
+        if (hi[lane] > r.max || (hi[lane] == r.max && hp < r.max_pos)) {
+            r.max = hi[lane];
+            r.max_pos = hp;
+        }
+    }
+    extremes_tail<T, Min, Max>(v, i, n, r);
+    return r;
+}
+
+template<typename T, bool Min, bool Max>
+MinMaxPos<T> extremes_baseline(const T* v, std::size_t n, T lo, T hi) {
+    return extremes_block<T, 16 / sizeof(T), Min, Max>(v, n, lo, hi);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+template<typename T, bool Min, bool Max>
+__attribute__((target("avx2")))
+MinMaxPos<T> extremes_avx2(const T* v, std::size_t n, T lo, T hi) {
+    return extremes_block<T, 32 / sizeof(T), Min, Max>(v, n, lo, hi);
+}
+
+template<typename T, bool Min, bool Max>
+__attribute__((target("avx512f")))
+MinMaxPos<T> extremes_avx512(const T* v, std::size_t n, T lo, T hi) {
+    return extremes_block<T, 64 / sizeof(T), Min, Max>(v, n, lo, hi);
+}
+#endif
+#endif
+
+//! kernel da melhor versao disponivel sobre v[0, n), partindo de lo e hi
+template<typename T, bool Min, bool Max>
+MinMaxPos<T> extremes_dispatch(const T* v, std::size_t n, T lo, T hi) {
+#if defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+    switch (simd_level()) {
+        case SimdLevel::AVX512:
+            return extremes_avx512<T, Min, Max>(v, n, lo, hi);
+        case SimdLevel::AVX2:
+            return extremes_avx2<T, Min, Max>(v, n, lo, hi);
+        default:
+            break;
+    }
+#endif
+    if (simd_level() != SimdLevel::SCALAR) {
+        return extremes_baseline<T, Min, Max>(v, n, lo, hi);
+    }
+#endif
+    MinMaxPos<T> r = {lo, 0, hi, 0};
+    extremes_tail<T, Min, Max>(v, 0, n, r);
+    return r;
+}
+
+//! extremos de v[0, n) em blocos (as posicoes nas pistas tem 32 bits)
+template<typename T, bool Min, bool Max>
+MinMaxPos<T> extremes(const T* v, std::size_t n) {
+    static_assert(std::is_same<T, std::int32_t>::value ||
+                  std::is_same<T, std::int64_t>::value ||
+                  std::is_same<T, float>::value ||
+                  std::is_same<T, double>::value,
+                  "tipo sem kernel de maximo/minimo");
+    if (n == 0) {
+        throw std::out_of_range("vetor vazio");
+    }
+    std::size_t start = 0;
+    if (std::is_floating_point<T>::value) {
+        while (start < n && v[start] != v[start]) {  // pula NaN iniciais
+            start++;
+        }
+        if (start == n) {
+            return {v[0], 0, v[0], 0};
+        }
+    }
+    // cada bloco parte dos extremos ja vistos (nunca NaN), entao um bloco
+    // que comeca com NaN nao perde os seus valores
+    constexpr std::size_t BLOCK = std::size_t(1) << 30;
+    MinMaxPos<T> r = {v[start], start, v[start], start};
+    for (std::size_t begin = start; begin < n; begin += BLOCK) {
+        std::size_t count = n - begin < BLOCK ? n - begin : BLOCK;
+        MinMaxPos<T> b = extremes_dispatch<T, Min, Max>(v + begin, count,
+                                                        r.min, r.max);
+        if (b.min < r.min) {  // empate: fica o bloco anterior
+            r.min = b.min;
+            r.min_pos = begin + b.min_pos;
+        }
+        if (b.max > r.max) {
+            r.max = b.max;
+            r.max_pos = begin + b.max_pos;
+        }
+    }
+    return r;
+}
+
+}  // namespace detail
+
+}  // namespace structures
+
+template<typename T>
+std::size_t structures::argmax(const T* v, std::size_t n) {
+    return detail::extremes<T, false, true>(v, n).max_pos;
+}
+
+template<typename T>
+std::size_t structures::argmin(const T* v, std::size_t n) {
+    return detail::extremes<T, true, false>(v, n).min_pos;
+}
+
+template<typename T>
+structures::MinMaxPos<T> structures::minmax_pos(const T* v, std::size_t n) {
+    return detail::extremes<T, true, true>(v, n);
+}
+
+#undef STRUCTURES_ALWAYS_INLINE
+
+#endif
@@ -0,0 +1,191 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! argmax, argmin e minmax_pos: conferem contra um laco simples para
+//! int32, int64, float e double (tamanhos que nao enchem as pistas,
+//! empates, limites dos inteiros, NaN no inicio, no meio e em tudo),
+//! kernels partindo de extremos ja vistos com o bloco comecando em NaN e,
+//! se houver memoria, um vetor de 2^30 + 256 floats com NaN no inicio do
+//! segundo bloco; depois mede GB/s contra o laco original de maximo.cpp.
+//!
+//!     g++ -std=c++17 -O2 bench_argmax.cpp -o bench_argmax
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "./argmax.h"
+
+//! laco de referencia: primeira ocorrencia, NaN ignorado
+template<typename T>
+structures::MinMaxPos<T> reference(const T* v, std::size_t n) {
+    std::size_t start = 0;
+    while (start < n && v[start] != v[start]) {
+        start++;
+    }
+    if (start == n) {
+        return {v[0], 0, v[0], 0};
+    }
+    structures::MinMaxPos<T> r = {v[start], start, v[start], start};
+    for (std::size_t i = start + 1; i < n; i++) {
+        if (v[i] < r.min) {
+            r.min = v[i];
+            r.min_pos = i;
+        }
+        if (v[i] > r.max) {
+            r.max = v[i];
+            r.max_pos = i;
+        }
+    }
+    return r;
+}
+
+//! laco original de posicao() em maximo.cpp
+template<typename T>
+std::size_t posicao_original(const T* v, std::size_t n) {
+    std::size_t indice = 0;
+    T maior = v[indice];
+    for (std::size_t i = 1; i < n; i++) {
+        if (v[i] > maior) {
+            maior = v[i];
+            indice = i;
+        }
+    }
+    return indice;
+}
+
+template<typename T>
+void check_type(std::mt19937& rng) {
+    const T nan = std::numeric_limits<T>::has_quiet_NaN ?
+                  std::numeric_limits<T>::quiet_NaN() : T(0);
+    for (int round = 0; round < 3000; round++) {
+        std::size_t n = 1 + rng() % (round < 2000 ? 70 : 5000);
+        std::vector<T> v(n);
+        int range = round % 3 == 0 ? 4 : 1000000;  // muitos empates
+        for (auto& x : v) {
+            x = static_cast<T>(static_cast<int>(rng() % range) - range / 2);
+        }
+        if (round % 11 == 0) {
+            v[rng() % n] = std::numeric_limits<T>::max();
+            v[rng() % n] = std::numeric_limits<T>::lowest();
+        }
+        if (std::numeric_limits<T>::has_quiet_NaN) {
+            switch (round % 5) {
+                case 0: v[0] = nan; break;
+                case 1:
+                    for (std::size_t i = 0; i < n; i += 1 + rng() % 3) {
+                        v[i] = nan;
+                    }
+                    break;
+                case 2:
+                    for (auto& x : v) {
+                        x = nan;
+                    }
+                    break;
+                default: break;
+            }
+        }
+        structures::MinMaxPos<T> expected = reference(v.data(), n);
+        structures::MinMaxPos<T> got = structures::minmax_pos(v.data(), n);
+        assert(got.min_pos == expected.min_pos);
+        assert(got.max_pos == expected.max_pos);
+        assert(structures::argmax(v.data(), n) == expected.max_pos);
+        assert(structures::argmin(v.data(), n) == expected.min_pos);
+    }
+    bool threw = false;
+    try {
+        structures::argmax(static_cast<const T*>(nullptr), 0);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+//! um bloco que comeca com NaN, partindo de extremos de um bloco anterior
+template<typename T>
+void check_seeded() {
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    std::vector<T> v(100, T(1));
+    v[0] = nan;
+    v[37] = T(5);
+    v[61] = T(-5);
+    auto r = structures::detail::extremes_dispatch<T, true, true>(
+        v.data(), v.size(), T(0), T(2));
+    assert(r.max == T(5) && r.max_pos == 37);
+    assert(r.min == T(-5) && r.min_pos == 61);
+    // nada melhor que os extremos anteriores: fica a posicao 0 (o anterior)
+    r = structures::detail::extremes_dispatch<T, true, true>(
+        v.data(), v.size(), T(-9), T(9));
+    assert(r.min == T(-9) && r.max == T(9));
+    assert(r.min_pos == 0 && r.max_pos == 0);
+}
+
+void check_blocks() {
+    const std::size_t n = (std::size_t(1) << 30) + 256;
+    // calloc grande: paginas zeradas sob demanda, so as escritas ocupam
+    float* v = static_cast<float*>(std::calloc(n, sizeof(float)));
+    if (v == nullptr) {
+        std::printf("blocos de 2^30: sem memoria, ignorado\n");
+        return;
+    }
+    const std::size_t second = std::size_t(1) << 30;
+    v[second] = std::numeric_limits<float>::quiet_NaN();
+    v[second + 5] = 7.0f;
+    v[second + 6] = -3.0f;
+    structures::MinMaxPos<float> r = structures::minmax_pos(v, n);
+    assert(r.max_pos == second + 5 && r.min_pos == second + 6);
+    v[second + 5] = 0.0f;  // empate com o primeiro bloco: fica a posicao 0
+    assert(structures::argmax(v, n) == 0);
+    std::free(v);
+    std::printf("blocos de 2^30: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+template<typename T>
+void measure(const char* name, std::mt19937& rng) {
+    const std::size_t n = std::size_t(64) << 20 >> (sizeof(T) == 8);
+    std::vector<T> v(n);
+    for (auto& x : v) {
+        x = static_cast<T>(rng() % 1000000);
+    }
+    std::size_t positions[2];
+    double took[3];
+    took[0] = seconds([&] { positions[0] = posicao_original(v.data(), n); });
+    took[1] = seconds([&] { positions[1] = structures::argmax(v.data(), n); });
+    structures::MinMaxPos<T> both;
+    took[2] = seconds([&] { both = structures::minmax_pos(v.data(), n); });
+    assert(positions[0] == positions[1] && both.max_pos == positions[0]);
+    double bytes = n * sizeof(T) / 1e9;
+    std::printf("%-7s laco original %6.2f GB/s  argmax %6.2f GB/s  "
+                "minmax_pos %6.2f GB/s\n", name, bytes / took[0],
+                bytes / took[1], bytes / took[2]);
+}
+
+int main() {
+    std::mt19937 rng(49);
+    check_type<std::int32_t>(rng);
+    check_type<std::int64_t>(rng);
+    check_type<float>(rng);
+    check_type<double>(rng);
+    check_seeded<float>();
+    check_seeded<double>();
+    std::printf("argmax: ok\n");
+    check_blocks();
+    measure<std::int32_t>("int32", rng);
+    measure<std::int64_t>("int64", rng);
+    measure<float>("float", rng);
+    measure<double>("double", rng);
+    return 0;
+}
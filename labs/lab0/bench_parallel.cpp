@@ -0,0 +1,253 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! ThreadPool e kernels paralelos: confere que run() executa cada t uma
+//! vez e relanca a excecao de um job, run() aninhado no mesmo grupo e
+//! entre grupos (que antes travava), a afinidade com pin (threads criadas
+//! presas, quem chama livre), o construtor que falha ao criar uma thread
+//! (sem sanitizadores), os pedacos de parallel_for e parallel_reduce, e os
+//! kernels contra maximo.cpp; depois mede 256 MB com 1, 2 e 4 threads.
+//!
+//!     g++ -std=c++17 -O2 -pthread bench_parallel.cpp -o bench_parallel
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#endif
+
+#include "./maximo.cpp"
+#include "./parallel_kernels.h"
+
+void check_pool() {
+    for (unsigned threads : {1u, 2u, 5u}) {
+        structures::ThreadPool pool(threads);
+        assert(pool.size() == threads);
+        for (int round = 0; round < 100; round++) {
+            std::vector<int> hits(threads, 0);
+            pool.run([&](unsigned t) { hits[t]++; });
+            assert(hits == std::vector<int>(threads, 1));
+        }
+        bool threw = false;
+        try {
+            pool.run([&](unsigned t) {
+                if (t == threads - 1) {
+                    throw std::runtime_error("job");
+                }
+            });
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+        std::atomic<int> count{0};
+        pool.run([&](unsigned) { count++; });  // continua utilizavel
+        assert(count == static_cast<int>(threads));
+    }
+
+    // aninhado: no mesmo grupo e entre dois grupos, nos dois sentidos
+    structures::ThreadPool a(3), b(3);
+    std::atomic<int> inner{0};
+    a.run([&](unsigned) {
+        a.run([&](unsigned) { inner++; });
+        b.run([&](unsigned) { inner++; });
+    });
+    assert(inner == 3 * 3 + 3 * 3);
+    inner = 0;
+    for (int round = 0; round < 50; round++) {
+        std::thread other([&] {
+            b.run([&](unsigned) { a.run([&](unsigned) { inner++; }); });
+        });
+        a.run([&](unsigned) { b.run([&](unsigned) { inner++; }); });
+        other.join();
+    }
+    assert(inner == 50 * 2 * 9);
+}
+
+#if defined(__linux__)
+void check_affinity() {
+    cpu_set_t original;
+    CPU_ZERO(&original);
+    assert(sched_getaffinity(0, sizeof(original), &original) == 0);
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &original)) {
+            cpus.push_back(cpu);
+        }
+    }
+    structures::ThreadPool pool(4, true);
+    assert(pool.pinned());
+    std::vector<cpu_set_t> masks(pool.size());
+    pool.run([&](unsigned t) {
+        CPU_ZERO(&masks[t]);
+        pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t),
+                               &masks[t]);
+    });
+    assert(CPU_EQUAL(&masks[0], &original));  // quem chama nao e preso
+    for (unsigned t = 1; t < pool.size(); t++) {
+        assert(CPU_COUNT(&masks[t]) == 1);
+        assert(CPU_ISSET(cpus[t % cpus.size()], &masks[t]));
+    }
+    assert(!structures::ThreadPool(4).pinned());
+}
+
+#if !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+//! pilhas de 1 GiB e espaco de enderecamento limitado: so as primeiras
+//! threads sao criadas; o construtor precisa esperar essas e relancar
+void check_spawn_failure() {
+    pthread_attr_t attr, previous;
+    pthread_getattr_default_np(&previous);
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, std::size_t(1) << 30);
+    pthread_setattr_default_np(&attr);
+    struct rlimit limit, saved;
+    getrlimit(RLIMIT_AS, &saved);
+    limit = saved;
+    limit.rlim_cur = std::size_t(3) << 30;  // + o que o processo ja usa
+    {
+        std::FILE* statm = std::fopen("/proc/self/statm", "r");
+        unsigned long pages = 0;
+        if (statm != nullptr && std::fscanf(statm, "%lu", &pages) == 1) {
+            limit.rlim_cur += pages * 4096;
+        }
+        if (statm != nullptr) {
+            std::fclose(statm);
+        }
+    }
+    setrlimit(RLIMIT_AS, &limit);
+    bool threw = false;
+    try {
+        structures::ThreadPool pool(16);
+    } catch (const std::system_error&) {
+        threw = true;
+    }
+    setrlimit(RLIMIT_AS, &saved);
+    pthread_setattr_default_np(&previous);
+    pthread_attr_destroy(&attr);
+    pthread_attr_destroy(&previous);
+    assert(threw);
+    std::printf("ThreadPool com falha ao criar thread: ok\n");
+}
+#else
+void check_spawn_failure() {}
+#endif
+#else
+void check_affinity() {}
+void check_spawn_failure() {}
+#endif
+
+void check_algorithms() {
+    std::mt19937 rng(50);
+    for (unsigned threads : {1u, 3u, 4u}) {
+        structures::ThreadPool pool(threads);
+        for (std::size_t n : {0u, 1u, 63u, 64u, 191u, 1000u, 100000u}) {
+            std::vector<int> seen(n, 0);
+            std::atomic<bool> aligned{true};
+            structures::parallel_for(pool, n,
+                [&](std::size_t begin, std::size_t end) {
+                    if (begin % 64 != 0) {
+                        aligned = false;
+                    }
+                    for (std::size_t i = begin; i < end; i++) {
+                        seen[i]++;
+                    }
+                }, 0);
+            assert(seen == std::vector<int>(n, 1) && aligned);
+            if (n == 0) {
+                continue;
+            }
+            std::size_t sum = structures::parallel_reduce<std::size_t>(
+                pool, n, [](std::size_t begin, std::size_t end) {
+                    std::size_t s = 0;
+                    for (std::size_t i = begin; i < end; i++) {
+                        s += i;
+                    }
+                    return s;
+                }, [](std::size_t l, std::size_t r) { return l + r; }, 0);
+            assert(sum == n * (n - 1) / 2);
+
+            std::vector<int> v(n), w(n), x(n), y(n);
+            for (std::size_t i = 0; i < n; i++) {
+                v[i] = static_cast<int>(rng() % 50);  // muitos empates
+                w[i] = static_cast<int>(rng() % 50);
+            }
+            int N = static_cast<int>(n);
+            assert(structures::parallel_posicao(v.data(), n, pool, 0) ==
+                   static_cast<std::size_t>(posicao(v.data(), N)));
+            x = v;
+            y = v;
+            maximo_vetores(x.data(), w.data(), N);
+            structures::parallel_maximo_vetores(y.data(), w.data(), n,
+                                                pool, 0);
+            assert(x == y);
+            inversao(x.data(), N);
+            structures::parallel_inversao(y.data(), n, pool, 0);
+            assert(x == y);
+        }
+        // pedacos so de NaN perdem para os que tem numeros
+        std::vector<double> d(4096, std::numeric_limits<double>::quiet_NaN());
+        d[4000] = 1.0;
+        d[4001] = 2.0;
+        structures::MaxPos<double> m =
+            structures::parallel_maximo_posicao(d.data(), d.size(), pool, 0);
+        assert(m.pos == 4001 && m.max == 2.0);
+    }
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check_pool();
+    check_affinity();
+    check_algorithms();
+    std::printf("ThreadPool: ok\n");
+    check_spawn_failure();
+
+    const std::size_t n = std::size_t(64) << 20;  // 256 MB de int
+    std::vector<int> v(n), w(n);
+    std::mt19937 rng(1);
+    for (std::size_t i = 0; i < n; i++) {
+        v[i] = static_cast<int>(rng());
+        w[i] = static_cast<int>(rng());
+    }
+    int N = static_cast<int>(n);
+    std::size_t expected = 0;
+    double serial[2];
+    serial[0] = seconds([&] { expected = posicao(v.data(), N); });
+    serial[1] = seconds([&] { maximo_vetores(v.data(), w.data(), N); });
+    std::printf("%u CPU(s)\nmaximo.cpp:   posicao %6.2f GB/s  "
+                "maximo_vetores %6.2f GB/s\n",
+                std::thread::hardware_concurrency(), n * 4 / serial[0] / 1e9,
+                n * 8 / serial[1] / 1e9);
+    expected = posicao(v.data(), N);
+    for (unsigned threads : {1u, 2u, 4u}) {
+        structures::ThreadPool pool(threads, true);
+        std::size_t pos = 0;
+        double took[2];
+        took[0] = seconds([&] {
+            pos = structures::parallel_posicao(v.data(), n, pool);
+        });
+        took[1] = seconds([&] {
+            structures::parallel_maximo_vetores(v.data(), w.data(), n, pool);
+        });
+        assert(pos == expected);
+        std::printf("%u thread(s): posicao %6.2f GB/s  "
+                    "maximo_vetores %6.2f GB/s\n", threads,
+                    n * 4 / took[0] / 1e9, n * 8 / took[1] / 1e9);
+    }
+    return 0;
+}
@@ -1,14 +1,10 @@
+#include "./argmax.h"
+
 int posicao(int vet[], int n) {
-    int indice = 0;
-    int maior = vet[indice];
-    for (int i = 1; i < n; i++) {
-        if (vet[i] > maior) {
-            maior = vet[i];
-            indice = i;
-        }
+    if (n <= 0) {
+        return 0;
     }
-
-    return indice;
+    return static_cast<int>(structures::argmax(vet, n));
 }
 
 struct maxpos {
@@ -17,14 +13,11 @@ struct maxpos {
 };
 
 maxpos maximo_posicao(int vet[], int n) {
-    maxpos resultado = {0, vet[0]};
-    for (int i = 1; i < n; i++) {
-        if (vet[i] > resultado.max) {
-            resultado.max = vet[i];
-            resultado.pos = i;
-        }
+    if (n <= 0) {
+        return {0, 0};
     }
-
+    int pos = posicao(vet, n);
+    maxpos resultado = {vet[pos], pos};
     return resultado;
 }
 
@@ -0,0 +1,329 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_PARALLEL_H
+#define STRUCTURES_PARALLEL_H
+
+#include <algorithm>  // std::max, std::min
+#include <condition_variable>  // std::condition_variable
+#include <cstdint>  // std::size_t, std::uint64_t
+#include <exception>  // std::exception_ptr
+#include <mutex>  // std::mutex, std::unique_lock
+#include <thread>  // std::thread
+#include <utility>  // std::move
+#include <vector>  // std::vector
+
+#if defined(__linux__)
+#include <pthread.h>  // pthread_setaffinity_np
+#include <sched.h>  // cpu_set_t
+#endif
+
+namespace structures {
+
+//! abaixo disso (em elementos) os algoritmos paralelos usam uma thread
+const std::size_t PARALLEL_MIN_SIZE = 1u << 20;
+
+//! CLASSE GRUPO DE THREADS
+/*!
+    Threads criadas uma vez e reaproveitadas: run(job) executa job(t) para
+    cada t em [0, size()), job(0) na própria thread que chamou, e só
+    retorna quando todas terminam. A primeira exceção lançada por um job é
+    relançada por run().
+
+    Os algoritmos dão sempre o mesmo pedaço contíguo do vetor à mesma
+    thread t. Com pin == true (Linux), cada thread criada pelo grupo
+    (t >= 1) fica presa à CPU t da lista de CPUs permitidas a quem cria o
+    grupo (sched_getaffinity), recomeçando a lista se faltarem; assim as
+    páginas que ela tocar primeiro (ao inicializar o vetor com parallel_for
+    no mesmo grupo) ficam no nó NUMA dela e as passadas seguintes leem
+    memória local. A thread 0 é quem chama run() e nunca é presa pelo
+    grupo: para o pedaço 0 ser local, quem chama deve fixar a própria
+    afinidade. Prender é só uma otimização: se o sistema recusar, as
+    threads continuam livres e pinned() retorna falso.
+
+    Chamar run() de dentro de um job de qualquer grupo (este ou outro)
+    executa tudo na thread atual, em vez de travar.
+*/
+class ThreadPool {
+ public:
+    //! construtor com 'threads' threads (0: uma por CPU)
+    explicit ThreadPool(unsigned threads = 0, bool pin = false);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    //! destrutor
+    ~ThreadPool();
+    //! metodo executa job(t) para t em [0, size()) e espera todos
+    template<typename Job>
+    void run(const Job& job);
+    //! metodo retorna a quantidade de threads (incluindo a que chama run)
+    unsigned size() const;
+    //! metodo verifica se todas as threads criadas foram presas a CPUs
+    bool pinned() const;
+
+ private:
+    //! laco de uma thread do grupo
+    void work(unsigned t);
+    //! executa o job atual como 't', guardando a primeira excecao
+    void execute(unsigned t);
+    //! prende as threads criadas as CPUs permitidas; falso se nao conseguir
+    bool pin_workers();
+    //! para e espera as threads criadas
+    void stop_workers();
+
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;  // um run() por vez
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    void (*invoke_)(const void* job, unsigned t);
+    const void* job_;
+    std::uint64_t generation_;
+    unsigned pending_;
+    bool stop_;
+    bool pinned_;
+    std::exception_ptr error_;
+};
+
+//! grupo compartilhado, com uma thread por CPU
+ThreadPool& default_pool();
+
+//! executa body(begin, end) sobre pedacos contiguos de [0, n)
+/*!
+    Um pedaço por thread, com bordas múltiplas de 64 elementos (threads
+    vizinhas não escrevem na mesma linha de cache). Com n < min_size tudo
+    roda em body(0, n) na thread atual.
+*/
+template<typename Body>
+void parallel_for(ThreadPool& pool, std::size_t n, const Body& body,
+                  std::size_t min_size = PARALLEL_MIN_SIZE);
+
+//! reduz [0, n): combine(... combine(map(pedaco 0), map(pedaco 1)) ...)
+/*!
+    map(begin, end) produz o resultado de um pedaço; os resultados são
+    combinados em ordem, da esquerda para a direita, então um combine que
+    prefere o da esquerda nos empates preserva "primeira ocorrência". Com
+    n < min_size o resultado é map(0, n).
+*/
+template<typename R, typename Map, typename Combine>
+R parallel_reduce(ThreadPool& pool, std::size_t n, const Map& map,
+                  const Combine& combine,
+                  std::size_t min_size = PARALLEL_MIN_SIZE);
+
+namespace detail {
+
+//! grupo cujo job a thread atual esta executando
+inline const ThreadPool*& current_pool() {
+    thread_local const ThreadPool* pool = nullptr;
+    return pool;
+}
+
+//! inicio do pedaco 'chunk' de 'chunks' sobre [0, n)
+inline std::size_t chunk_begin(std::size_t n, std::size_t chunk,
+                               std::size_t chunks) {
+    if (chunk >= chunks) {
+        return n;
+    }
+    std::size_t begin = n / chunks * chunk + std::min(chunk, n % chunks);
+    begin &= ~std::size_t(63);
+    return begin;
+}
+
+}  // namespace detail
+
+}  // namespace structures
+
+inline structures::ThreadPool::ThreadPool(unsigned threads, bool pin) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    invoke_ = nullptr;
+    job_ = nullptr;
+    generation_ = 0;
+    pending_ = 0;
+    stop_ = false;
+    pinned_ = false;
+    try {
+        workers_.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; t++) {
+            workers_.emplace_back(&ThreadPool::work, this, t);
+        }
+    } catch (...) {
+        stop_workers();  // o destrutor nao roda se o construtor lancar
+        throw;
+    }
+    if (pin) {
+        pinned_ = pin_workers();
+    }
+}
+
+inline structures::ThreadPool::~ThreadPool() {
+    stop_workers();
+}
+
+template<typename Job>
+void structures::ThreadPool::run(const Job& job) {
+    // dentro de um job (deste grupo ou de outro) tudo roda aqui: esperar
+    // por outro grupo que espera por este travaria
+    if (detail::current_pool() != nullptr || workers_.empty()) {
+        for (unsigned t = 0; t < size(); t++) {
+            job(t);
+        }
+        return;
+    }
+    std::lock_guard<std::mutex> serial(run_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        invoke_ = [](const void* j, unsigned t) {
+            (*static_cast<const Job*>(j))(t);
+        };
+        job_ = &job;
+        pending_ = static_cast<unsigned>(workers_.size());
+        error_ = nullptr;
+        generation_++;
+    }
+    start_.notify_all();
+    execute(0);
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+        error = error_;
+        error_ = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+inline unsigned structures::ThreadPool::size() const {
+    return static_cast<unsigned>(workers_.size()) + 1;
+}
+
+inline bool structures::ThreadPool::pinned() const {
+    return pinned_;
+}
+
+inline bool structures::ThreadPool::pin_workers() {
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (::sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return false;
+    }
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &allowed)) {
+            cpus.push_back(cpu);
+        }
+    }
+    if (cpus.empty()) {
+        return false;
+    }
+    bool ok = true;
+    for (std::size_t w = 0; w < workers_.size(); w++) {
+        // thread t = w + 1; a CPU cpus[0] fica para a thread que chama
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpus[(w + 1) % cpus.size()], &set);
+        ok = ::pthread_setaffinity_np(workers_[w].native_handle(),
+                                      sizeof(set), &set) == 0 && ok;
+    }
+    return ok;
+#else
+    return false;
+#endif
+}
+
+inline void structures::ThreadPool::stop_workers() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+}
+
+inline void structures::ThreadPool::work(unsigned t) {
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+        }
+        execute(t);
+        bool last;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            last = --pending_ == 0;
+        }
+        if (last) {
+            done_.notify_one();
+        }
+    }
+}
+
+inline void structures::ThreadPool::execute(unsigned t) {
+    const ThreadPool*& current = detail::current_pool();
+    const ThreadPool* previous = current;
+    current = this;
+    try {
+        invoke_(job_, t);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) {
+            error_ = std::current_exception();
+        }
+    }
+    current = previous;
+}
+
+inline structures::ThreadPool& structures::default_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+template<typename Body>
+void structures::parallel_for(ThreadPool& pool, std::size_t n,
+                              const Body& body, std::size_t min_size) {
+    std::size_t chunks = pool.size();
+    if (n < min_size || n < chunks * 64 || chunks == 1) {
+        if (n > 0) {
+            body(std::size_t(0), n);
+        }
+        return;
+    }
+    pool.run([&](unsigned t) {
+        std::size_t begin = detail::chunk_begin(n, t, chunks);
+        std::size_t end = detail::chunk_begin(n, t + 1, chunks);
+        if (begin < end) {
+            body(begin, end);
+        }
+    });
+}
+
+template<typename R, typename Map, typename Combine>
+R structures::parallel_reduce(ThreadPool& pool, std::size_t n, const Map& map,
+                              const Combine& combine, std::size_t min_size) {
+    std::size_t chunks = pool.size();
+    if (n < min_size || n < chunks * 64 || chunks == 1) {
+        return map(std::size_t(0), n);
+    }
+    std::vector<R> partial(chunks);
+    pool.run([&](unsigned t) {
+        std::size_t begin = detail::chunk_begin(n, t, chunks);
+        std::size_t end = detail::chunk_begin(n, t + 1, chunks);
+        partial[t] = map(begin, end);  // com n >= 64 * chunks, begin < end
+    });
+    R result = std::move(partial[0]);
+    for (std::size_t t = 1; t < chunks; t++) {
+        result = combine(std::move(result), std::move(partial[t]));
+    }
+    return result;
+}
+
+#endif
@@ -0,0 +1,104 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_PARALLEL_KERNELS_H
+#define STRUCTURES_PARALLEL_KERNELS_H
+
+#include <cstdint>  // std::size_t
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::swap
+
+#include "./argmax.h"
+#include "./parallel.h"
+
+namespace structures {
+
+//! maior valor de um vetor e a sua (primeira) posicao
+template<typename T>
+struct MaxPos {
+    T max;
+    std::size_t pos;
+};
+
+/*
+    Versões paralelas das funções de maximo.cpp, para vetores grandes
+    (maiores que a cache L3). Cada thread de 'pool' processa um pedaço
+    contíguo; abaixo de 'min_size' elementos tudo roda na thread atual.
+    As buscas usam os kernels SIMD de argmax.h em cada pedaço e mantêm a
+    primeira ocorrência nos empates.
+*/
+
+//! vet1[i] = max(vet1[i], vet2[i]) para i em [0, n)
+template<typename T>
+void parallel_maximo_vetores(T vet1[], const T vet2[], std::size_t n,
+                             ThreadPool& pool = default_pool(),
+                             std::size_t min_size = PARALLEL_MIN_SIZE);
+//! inverte vet[0, n)
+template<typename T>
+void parallel_inversao(T vet[], std::size_t n,
+                       ThreadPool& pool = default_pool(),
+                       std::size_t min_size = PARALLEL_MIN_SIZE);
+//! posicao do primeiro maior elemento de vet[0, n)
+template<typename T>
+std::size_t parallel_posicao(const T vet[], std::size_t n,
+                             ThreadPool& pool = default_pool(),
+                             std::size_t min_size = PARALLEL_MIN_SIZE);
+//! maior elemento de vet[0, n) e a sua primeira posicao
+template<typename T>
+MaxPos<T> parallel_maximo_posicao(const T vet[], std::size_t n,
+                                  ThreadPool& pool = default_pool(),
+                                  std::size_t min_size = PARALLEL_MIN_SIZE);
+
+}  // namespace structures
+
+template<typename T>
+void structures::parallel_maximo_vetores(T vet1[], const T vet2[],
+                                         std::size_t n, ThreadPool& pool,
+                                         std::size_t min_size) {
+    parallel_for(pool, n, [vet1, vet2](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            vet1[i] = vet1[i] > vet2[i] ? vet1[i] : vet2[i];
+        }
+    }, min_size);
+}
+
+template<typename T>
+void structures::parallel_inversao(T vet[], std::size_t n, ThreadPool& pool,
+                                   std::size_t min_size) {
+    // o par i troca vet[i] com vet[n - 1 - i]; dividimos os n / 2 pares
+    parallel_for(pool, n / 2, [vet, n](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::swap(vet[i], vet[n - 1 - i]);
+        }
+    }, min_size / 2);
+}
+
+template<typename T>
+std::size_t structures::parallel_posicao(const T vet[], std::size_t n,
+                                         ThreadPool& pool,
+                                         std::size_t min_size) {
+    return parallel_maximo_posicao(vet, n, pool, min_size).pos;
+}
+
+template<typename T>
+structures::MaxPos<T> structures::parallel_maximo_posicao(
+        const T vet[], std::size_t n, ThreadPool& pool,
+        std::size_t min_size) {
+    if (n == 0) {
+        throw std::out_of_range("vetor vazio");
+    }
+    return parallel_reduce<MaxPos<T>>(pool, n,
+        [vet](std::size_t begin, std::size_t end) {
+            std::size_t pos = begin + argmax(vet + begin, end - begin);
+            return MaxPos<T>{vet[pos], pos};
+        },
+        [](MaxPos<T> left, MaxPos<T> right) {
+            // empate fica com a esquerda; NaN (pedaco so de NaN) perde
+            bool left_nan = !(left.max == left.max);
+            bool right_nan = !(right.max == right.max);
+            if (right.max > left.max || (left_nan && !right_nan)) {
+                return right;
+            }
+            return left;
+        }, min_size);
+}
+
+#endif
@@ -0,0 +1,86 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ALLOCATION_COUNTER_H
+#define STRUCTURES_ALLOCATION_COUNTER_H
+
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::size_t
+#include <cstdlib>  // std::malloc, std::free
+#include <new>  // std::bad_alloc
+
+/*
+    Contagem de alocações do processo inteiro.
+
+    Em exatamente um arquivo .cpp do programa, defina
+    STRUCTURES_COUNT_ALLOCATIONS antes de incluir este cabeçalho: ali são
+    definidos operator new/delete que somam cada alocação aos contadores.
+    Sem isso os contadores continuam em zero. AllocationScope mede só o que
+    acontece entre a sua criação e a consulta.
+*/
+
+namespace structures {
+
+namespace detail {
+
+inline std::atomic<std::size_t> allocation_count{0};
+inline std::atomic<std::size_t> allocation_bytes{0};
+
+}  // namespace detail
+
+//! alocacoes feitas desde a criacao do objeto
+class AllocationScope {
+ public:
+    AllocationScope() {
+        count_ = detail::allocation_count.load();
+        bytes_ = detail::allocation_bytes.load();
+    }
+    //! metodo retorna quantas alocacoes houve
+    std::size_t allocations() const {
+        return detail::allocation_count.load() - count_;
+    }
+    //! metodo retorna quantos bytes foram alocados
+    std::size_t bytes() const {
+        return detail::allocation_bytes.load() - bytes_;
+    }
+
+ private:
+    std::size_t count_;
+    std::size_t bytes_;
+};
+
+}  // namespace structures
+
+#if defined(STRUCTURES_COUNT_ALLOCATIONS)
+#if defined(__GNUC__)
+// fora de linha: inlinados, o GCC veria o free() de um ponteiro vindo de
+// operator new e avisaria -Wmismatched-new-delete em cada delete
+#define STRUCTURES_ALLOCATOR_NOINLINE __attribute__((noinline))
+#else
+#define STRUCTURES_ALLOCATOR_NOINLINE
+#endif
+
+// as formas de vetor (new[]/delete[]) padrao chamam estas
+STRUCTURES_ALLOCATOR_NOINLINE void* operator new(std::size_t size) {
+    structures::detail::allocation_count.fetch_add(1,
+                                                   std::memory_order_relaxed);
+    structures::detail::allocation_bytes.fetch_add(size,
+                                                   std::memory_order_relaxed);
+    void* p = std::malloc(size > 0 ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+STRUCTURES_ALLOCATOR_NOINLINE void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+STRUCTURES_ALLOCATOR_NOINLINE void operator delete(void* p,
+                                                   std::size_t) noexcept {
+    std::free(p);
+}
+
+#undef STRUCTURES_ALLOCATOR_NOINLINE
+#endif
+
+#endif
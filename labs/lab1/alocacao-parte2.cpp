@@ -15,31 +15,40 @@ class Aluno {
     int matricula;
 };
 
-Aluno* turma_filtra(Aluno t[], int N, int menor_matr) {
+// um unico passo: escreve os alunos com matricula >= menor_matr em 'saida'
+// (com espaco para N alunos) e retorna quantos foram escritos
+int turma_filtra(Aluno t[], int N, int menor_matr, Aluno saida[]) {
     int size = 0;
-    Aluno* buffer = new Aluno[N];
     for (int i = 0; i < N; i++) {
         if (t[i].devolveMatricula() >= menor_matr) {
-            buffer[i] = t[i];
-            size++;
+            saida[size++] = t[i];
         }
     }
 
-    Aluno* tf = new Aluno[size];
-    for (int i = 0, j = 0; i < N; i++) {
-        if (t[i].devolveMatricula() >= menor_matr) {
-            tf[j] = t[i];
-            j++;
-        }
+    return size;
+}
+
+Aluno* turma_filtra(Aluno t[], int N, int menor_matr) {
+    // contagem so pelas matriculas (sem copiar nomes): saida no tamanho
+    // exato, escrita uma unica vez pela versao de 4 argumentos
+    int size = 0;
+    for (int i = 0; i < N; i++) {
+        size += t[i].devolveMatricula() >= menor_matr;
     }
 
+    Aluno* tf = new Aluno[size];
+    turma_filtra(t, N, menor_matr, tf);
     return tf;
 }
 
 int* turma_conta(Aluno t[], int N) {
     int* c = new int[26]();
     for (int i = 0; i < N; i++) {
-        c[t[i].devolveNome()[0] - 'A']++;
+        // nomes vazios ou que nao comecam com 'A'-'Z' nao sao contados
+        std::string nome = t[i].devolveNome();
+        if (!nome.empty() && nome[0] >= 'A' && nome[0] <= 'Z') {
+            c[nome[0] - 'A']++;
+        }
     }
 
     return c;
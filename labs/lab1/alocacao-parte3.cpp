@@ -3,12 +3,19 @@
 
 #include <string>
 
+#include "./buckets.h"
 
 class Aluno {
  public:
     Aluno() {}  // construtor
     ~Aluno() {}  // destrutor
-    std::string devolveNome() {
+    // o destrutor declarado suprime o mover implicito; sem estes, mover um
+    // Aluno copiaria o nome
+    Aluno(const Aluno&) = default;
+    Aluno(Aluno&&) = default;
+    Aluno& operator=(const Aluno&) = default;
+    Aluno& operator=(Aluno&&) = default;
+    const std::string& devolveNome() const {  // sem copiar o nome
         return nome;
     }
     int devolveMatricula() {
@@ -29,7 +36,11 @@ class Aluno {
 int* turma_conta(Aluno t[], int N) {
     int* c = new int[26]();
     for (int i = 0; i < N; i++) {
-        c[t[i].devolveNome()[0] - 'A']++;
+        // nomes vazios ou que nao comecam com 'A'-'Z' nao sao contados
+        const std::string& nome = t[i].devolveNome();
+        if (!nome.empty() && nome[0] >= 'A' && nome[0] <= 'Z') {
+            c[nome[0] - 'A']++;
+        }
     }
 
     return c;
@@ -57,7 +68,11 @@ Aluno **grupos_por_iniciais(Aluno t[], int N) {
     }
 
     for (int i = 0; i < N; i++) {
-        int letterIndex = t[i].devolveNome()[0] - 'A';
+        const std::string& nome = t[i].devolveNome();
+        if (nome.empty() || nome[0] < 'A' || nome[0] > 'Z') {
+            continue;  // fora dos grupos, como em turma_conta
+        }
+        int letterIndex = nome[0] - 'A';
         g[letterIndex][indexes[letterIndex]] = t[i];
         indexes[letterIndex]++;
     }
@@ -68,6 +83,45 @@ Aluno **grupos_por_iniciais(Aluno t[], int N) {
     return g;
 }
 
+// grupo da inicial do aluno (26 para nomes fora de 'A'-'Z'), sem copiar o nome
+std::size_t inicial(const Aluno& aluno) {
+    const std::string& nome = aluno.devolveNome();
+    return nome.empty() ? std::size_t(26) :
+        static_cast<std::size_t>(static_cast<unsigned char>(nome[0]) - 'A');
+}
+
+// agrupa 't' (copiada ou movida, conforme Item) num vetor do tamanho exato
+template<typename Item>
+Aluno *agrupa_por_inicial(Item t[], int N, std::size_t offsets[27],
+                          unsigned threads) {
+    Aluno *g = nullptr;
+    try {
+        return structures::group_by_alloc(t, N, 26, inicial,
+            [&g](std::size_t total) {
+                g = new Aluno[total];
+                return g;
+            }, offsets, threads);
+    } catch (...) {
+        delete[] g;
+        throw;
+    }
+}
+
+// versao em um unico vetor: os alunos de 't' sao copiados para o vetor
+// retornado, agrupados por inicial; o grupo da letra i ocupa
+// [offsets[i], offsets[i + 1]) e offsets[26] e o total (o tamanho do vetor).
+// Alunos cujo nome nao comeca com 'A'-'Z' ficam de fora.
+Aluno *grupos_por_iniciais(const Aluno t[], int N, std::size_t offsets[27],
+                           unsigned threads = 1) {
+    return agrupa_por_inicial(t, N, offsets, threads);
+}
+
+// como a anterior, mas move os alunos (os nomes em 't' ficam indefinidos)
+Aluno *grupos_por_iniciais_movendo(Aluno t[], int N, std::size_t offsets[27],
+                                   unsigned threads = 1) {
+    return agrupa_por_inicial(t, N, offsets, threads);
+}
+
 
 
 /*
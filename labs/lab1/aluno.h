@@ -0,0 +1,233 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ALUNO_H
+#define STRUCTURES_ALUNO_H
+
+#include <array>  // std::array
+#include <cstdint>  // std::size_t
+#include <cstring>  // std::memcpy
+#include <memory>  // std::unique_ptr
+#include <string>  // std::string
+#include <string_view>  // std::string_view
+#include <unordered_set>  // std::unordered_set
+#include <utility>  // std::move
+#include <vector>  // std::vector
+
+#include "./buckets.h"
+#include "./histogram.h"
+
+namespace structures {
+
+//! CLASSE CONJUNTO DE NOMES
+/*!
+    Guarda cada nome distinto uma única vez, em blocos de uma arena que
+    nunca são realocados: as string_view devolvidas por intern() valem
+    enquanto o conjunto existir. Nomes repetidos (comuns numa turma) não
+    ocupam memória nova nem fazem alocação.
+*/
+class NamePool {
+ public:
+    //! construtor
+    explicit NamePool(std::size_t block_size = 1 << 16);
+    NamePool(const NamePool&) = delete;
+    NamePool& operator=(const NamePool&) = delete;
+    //! metodo retorna a copia unica de 'nome'
+    std::string_view intern(std::string_view nome);
+    //! metodo retorna quantos nomes distintos existem
+    std::size_t size() const;
+    //! metodo retorna quantos bytes de nomes estao guardados
+    std::size_t bytes() const;
+
+ private:
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    char* cursor_;  // proxima posicao livre do bloco atual
+    std::size_t left_;  // bytes livres no bloco atual
+    std::size_t block_size_;
+    std::size_t bytes_;
+    std::unordered_set<std::string_view> names_;
+};
+
+//! CLASSE ALUNO
+/*!
+    Mesmo registro dos labs, mas devolveNome() devolve uma string_view (sem
+    cópia) e escreveNome() recebe o nome por valor e o move: quem passa um
+    temporário ou usa std::move não paga cópia nenhuma. Nomes curtos ficam
+    dentro da própria std::string (sem alocação).
+*/
+class Aluno {
+ public:
+    Aluno() = default;
+    //! construtor com nome e matricula
+    Aluno(std::string nome, int matricula);
+    //! metodo retorna o nome (valido enquanto o aluno nao mudar)
+    std::string_view devolveNome() const;
+    //! metodo retorna a matricula
+    int devolveMatricula() const;
+    //! metodo troca o nome (move o argumento)
+    void escreveNome(std::string nome);
+    //! metodo troca a matricula
+    void escreveMatricula(int matricula);
+
+ private:
+    std::string nome_;
+    int matricula_ = 0;
+};
+
+//! CLASSE ALUNO COM NOME COMPARTILHADO
+/*!
+    O nome é uma string_view para dentro de um NamePool: o registro tem
+    tamanho fixo, é copiado sem alocação, e alunos com o mesmo nome
+    compartilham os bytes. O NamePool precisa viver mais que os alunos.
+*/
+class PooledAluno {
+ public:
+    PooledAluno() = default;
+    //! construtor com nome (guardado em 'pool') e matricula
+    PooledAluno(NamePool& pool, std::string_view nome, int matricula);
+    //! metodo retorna o nome
+    std::string_view devolveNome() const;
+    //! metodo retorna a matricula
+    int devolveMatricula() const;
+    //! metodo troca o nome (guardado em 'pool')
+    void escreveNome(NamePool& pool, std::string_view nome);
+    //! metodo troca a matricula
+    void escreveMatricula(int matricula);
+
+ private:
+    std::string_view nome_;
+    int matricula_ = 0;
+};
+
+//! (5) conta os alunos por inicial ('A' a 'Z'), sem copiar nomes
+template<typename Registro>
+std::array<int, 26> turma_conta(const Registro t[], std::size_t N,
+                                unsigned threads = 1);
+//! (6) agrupa os alunos por inicial num unico vetor, movendo-os
+template<typename Registro>
+Buckets<Registro> grupos_por_iniciais(Registro t[], std::size_t N,
+                                      unsigned threads = 1);
+
+namespace detail {
+
+//! grupo da inicial de 'nome': 0 a 25 para 'A' a 'Z', 26 para as demais
+inline std::size_t initial_bucket(std::string_view nome) {
+    unsigned letter = nome.empty() ? 26 :
+        static_cast<unsigned char>(nome[0]) - 'A';
+    return letter < 26 ? letter : 26;
+}
+
+}  // namespace detail
+
+}  // namespace structures
+
+inline structures::NamePool::NamePool(std::size_t block_size) {
+    cursor_ = nullptr;
+    left_ = 0;
+    block_size_ = block_size > 0 ? block_size : 1;
+    bytes_ = 0;
+}
+
+inline std::string_view structures::NamePool::intern(std::string_view nome) {
+    auto found = names_.find(nome);
+    if (found != names_.end()) {
+        return *found;
+    }
+    char* copy;
+    if (nome.size() > block_size_ / 4) {
+        // nome grande: bloco proprio, sem desperdicar o bloco atual
+        blocks_.emplace_back(new char[nome.size() > 0 ? nome.size() : 1]);
+        copy = blocks_.back().get();
+    } else {
+        if (nome.size() > left_) {
+            blocks_.emplace_back(new char[block_size_]);
+            cursor_ = blocks_.back().get();
+            left_ = block_size_;
+        }
+        copy = cursor_;
+        cursor_ += nome.size();
+        left_ -= nome.size();
+    }
+    if (!nome.empty()) {
+        std::memcpy(copy, nome.data(), nome.size());
+    }
+    bytes_ += nome.size();
+    std::string_view stored(copy, nome.size());
+    names_.insert(stored);
+    return stored;
+}
+
+inline std::size_t structures::NamePool::size() const {
+    return names_.size();
+}
+
+inline std::size_t structures::NamePool::bytes() const {
+    return bytes_;
+}
+
+inline structures::Aluno::Aluno(std::string nome, int matricula):
+    nome_(std::move(nome)),
+    matricula_(matricula)
+{}
+
+inline std::string_view structures::Aluno::devolveNome() const {
+    return nome_;
+}
+
+inline int structures::Aluno::devolveMatricula() const {
+    return matricula_;
+}
+
+inline void structures::Aluno::escreveNome(std::string nome) {
+    nome_ = std::move(nome);
+}
+
+inline void structures::Aluno::escreveMatricula(int matricula) {
+    matricula_ = matricula;
+}
+
+inline structures::PooledAluno::PooledAluno(NamePool& pool,
+                                            std::string_view nome,
+                                            int matricula):
+    nome_(pool.intern(nome)),
+    matricula_(matricula)
+{}
+
+inline std::string_view structures::PooledAluno::devolveNome() const {
+    return nome_;
+}
+
+inline int structures::PooledAluno::devolveMatricula() const {
+    return matricula_;
+}
+
+inline void structures::PooledAluno::escreveNome(NamePool& pool,
+                                                 std::string_view nome) {
+    nome_ = pool.intern(nome);
+}
+
+inline void structures::PooledAluno::escreveMatricula(int matricula) {
+    matricula_ = matricula;
+}
+
+template<typename Registro>
+std::array<int, 26> structures::turma_conta(const Registro t[], std::size_t N,
+                                            unsigned threads) {
+    std::array<std::size_t, 256> bytes = byte_histogram(
+        t, N, [](const Registro& aluno) {
+            return detail::initial_bucket(aluno.devolveNome());
+        }, threads);
+    std::array<int, 26> c = {};
+    for (int letter = 0; letter < 26; letter++) {
+        c[letter] = static_cast<int>(bytes[letter]);
+    }
+    return c;
+}
+
+template<typename Registro>
+structures::Buckets<Registro> structures::grupos_por_iniciais(
+        Registro t[], std::size_t N, unsigned threads) {
+    return group_by(t, N, 26, [](const Registro& aluno) {
+        return detail::initial_bucket(aluno.devolveNome());
+    }, threads);
+}
+
+#endif
@@ -0,0 +1,222 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! Aluno com string_view, NamePool e PooledAluno: confere os nomes, o
+//! compartilhamento e a estabilidade dos nomes internados, turma_conta e
+//! grupos_por_iniciais dos tres registros contra o Aluno de
+//! alocacao-parte2.cpp (devolveNome por valor); depois conta alocacoes e
+//! mede o tempo de montar, contar e agrupar 1M alunos com 1000 nomes
+//! distintos longos demais para o SSO.
+//!
+//!     g++ -std=c++17 -O2 -pthread bench_aluno.cpp -o bench_aluno
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define STRUCTURES_COUNT_ALLOCATIONS  // operator new contado, so aqui
+#include "./allocation_counter.h"
+#include "./alocacao-parte2.cpp"
+#include "./aluno.h"
+
+//! agrupamento original (26 vetores, copiando pelo devolveNome por valor)
+Aluno** grupos_originais(Aluno t[], int N) {
+    int* c = turma_conta(t, N);
+    int* indexes = new int[26]();
+    Aluno** g = new Aluno*[26];
+    for (int i = 0; i < 26; i++) {
+        g[i] = new Aluno[c[i]];
+    }
+    for (int i = 0; i < N; i++) {
+        std::string nome = t[i].devolveNome();
+        if (!nome.empty() && nome[0] >= 'A' && nome[0] <= 'Z') {
+            g[nome[0] - 'A'][indexes[nome[0] - 'A']++] = t[i];
+        }
+    }
+    delete[] c;
+    delete[] indexes;
+    return g;
+}
+
+std::vector<std::string> distinct_names(std::mt19937& rng, std::size_t n,
+                                        std::size_t min_length) {
+    std::vector<std::string> nomes(n);
+    for (auto& nome : nomes) {
+        std::size_t length = min_length + rng() % 20;
+        for (std::size_t k = 0; k < length; k++) {
+            nome += static_cast<char>(k == 0 ? 'A' - 2 + rng() % 30 :
+                                               'a' + rng() % 26);
+        }
+    }
+    return nomes;
+}
+
+template<typename Registro>
+void same_groups(Registro t[], std::size_t N, Aluno original[]) {
+    int* c = turma_conta(original, static_cast<int>(N));
+    std::array<int, 26> counted = structures::turma_conta(t, N, 2);
+    Aluno** g = grupos_originais(original, static_cast<int>(N));
+    structures::Buckets<Registro> groups =
+        structures::grupos_por_iniciais(t, N, 2);
+    for (int l = 0; l < 26; l++) {
+        assert(counted[l] == c[l]);
+        assert(groups.offsets[l + 1] - groups.offsets[l] ==
+               static_cast<std::size_t>(c[l]));
+        for (int k = 0; k < c[l]; k++) {
+            assert(groups.items[groups.offsets[l] + k].devolveNome() ==
+                   g[l][k].devolveNome());
+        }
+        delete[] g[l];
+    }
+    delete[] g;
+    delete[] c;
+}
+
+void check() {
+    std::mt19937 rng(47);
+    {
+        // escreveNome move: o buffer de um nome longo passa sem copia
+        std::string longo(100, 'x');
+        const char* buffer = longo.data();
+        structures::Aluno a;
+        a.escreveNome(std::move(longo));
+        assert(a.devolveNome().data() == buffer);
+        structures::AllocationScope scope;
+        for (int i = 0; i < 1000; i++) {
+            assert(a.devolveNome().size() == 100);
+        }
+        assert(scope.allocations() == 0);
+    }
+    {
+        structures::NamePool pool(64);  // blocos pequenos: muitos blocos
+        std::vector<std::string> nomes = distinct_names(rng, 500, 0);
+        nomes.push_back("");
+        nomes.push_back(std::string(1000, 'G'));  // maior que o bloco
+        std::vector<std::string_view> views;
+        for (const auto& nome : nomes) {
+            views.push_back(pool.intern(nome));
+        }
+        for (std::size_t i = 0; i < nomes.size(); i++) {
+            assert(views[i] == nomes[i]);  // validas depois de novos blocos
+            std::string copia = nomes[i];
+            structures::AllocationScope scope;
+            std::string_view again = pool.intern(copia);
+            assert(again.data() == views[i].data());
+            assert(scope.allocations() == 0);  // repetido nao aloca
+        }
+    }
+    for (int round = 0; round < 30; round++) {
+        std::size_t N = round < 20 ? rng() % 300 : 70000 + rng() % 1000;
+        std::vector<std::string> distinct = distinct_names(rng, 50, 0);
+        structures::NamePool pool;
+        std::vector<Aluno> original(N);
+        std::vector<structures::Aluno> alunos(N);
+        std::vector<structures::PooledAluno> pooled(N);
+        for (std::size_t i = 0; i < N; i++) {
+            const std::string& nome = distinct[rng() % distinct.size()];
+            original[i].escreveNome(nome);
+            original[i].escreveMatricula(static_cast<int>(i));
+            alunos[i] = structures::Aluno(nome, static_cast<int>(i));
+            pooled[i] = structures::PooledAluno(pool, nome,
+                                                static_cast<int>(i));
+            assert(alunos[i].devolveNome() == nome);
+            assert(pooled[i].devolveNome() == nome);
+            assert(pooled[i].devolveMatricula() == static_cast<int>(i));
+        }
+        assert(pool.size() <= distinct.size());
+        same_groups(alunos.data(), N, original.data());
+        same_groups(pooled.data(), N, original.data());
+    }
+    std::printf("Aluno/NamePool: ok\n");
+}
+
+template<typename Work>
+void measure(const char* label, Work work) {
+    structures::AllocationScope scope;
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    std::printf("%-36s %9zu alocacoes %8.1f MB %8.1f ms\n", label,
+                scope.allocations(), scope.bytes() / 1e6,
+                took.count() * 1e3);
+}
+
+int main() {
+    check();
+    const int N = 1000000;
+    std::mt19937 rng(1);
+    std::vector<std::string> distinct = distinct_names(rng, 1000, 16);
+    std::vector<const std::string*> nomes(N);
+    for (auto& nome : nomes) {
+        nome = &distinct[rng() % distinct.size()];
+    }
+
+    Aluno* original = nullptr;
+    structures::Aluno* alunos = nullptr;
+    structures::PooledAluno* pooled = nullptr;
+    structures::NamePool pool;
+    measure("montar: Aluno (parte2)", [&] {
+        original = new Aluno[N];
+        for (int i = 0; i < N; i++) {
+            original[i].escreveNome(*nomes[i]);
+            original[i].escreveMatricula(i);
+        }
+    });
+    measure("montar: structures::Aluno", [&] {
+        alunos = new structures::Aluno[N];
+        for (int i = 0; i < N; i++) {
+            alunos[i].escreveNome(*nomes[i]);
+            alunos[i].escreveMatricula(i);
+        }
+    });
+    measure("montar: PooledAluno", [&] {
+        pooled = new structures::PooledAluno[N];
+        for (int i = 0; i < N; i++) {
+            pooled[i].escreveNome(pool, *nomes[i]);
+            pooled[i].escreveMatricula(i);
+        }
+    });
+
+    int* c = nullptr;
+    measure("turma_conta: Aluno (parte2)", [&] {
+        c = turma_conta(original, N);
+    });
+    std::array<int, 26> counts[2];
+    measure("turma_conta: structures::Aluno", [&] {
+        counts[0] = structures::turma_conta(alunos, N);
+    });
+    measure("turma_conta: PooledAluno", [&] {
+        counts[1] = structures::turma_conta(pooled, N);
+    });
+    for (int l = 0; l < 26; l++) {
+        assert(counts[0][l] == c[l] && counts[1][l] == c[l]);
+    }
+    delete[] c;
+
+    Aluno** g = nullptr;
+    measure("grupos: 26 vetores (parte2)", [&] {
+        g = grupos_originais(original, N);
+    });
+    for (int l = 0; l < 26; l++) {
+        delete[] g[l];
+    }
+    delete[] g;
+    // os grupos sao destruidos fora da medida, como os 26 vetores acima
+    structures::Buckets<structures::Aluno> grupos;
+    structures::Buckets<structures::PooledAluno> grupos_pooled;
+    measure("grupos: structures::Aluno (move)", [&] {
+        grupos = structures::grupos_por_iniciais(alunos, N);
+    });
+    measure("grupos: PooledAluno", [&] {
+        grupos_pooled = structures::grupos_por_iniciais(pooled, N);
+    });
+    std::printf("nomes internados: %zu distintos, %zu bytes\n", pool.size(),
+                pool.bytes());
+    delete[] original;
+    delete[] alunos;
+    delete[] pooled;
+    return 0;
+}
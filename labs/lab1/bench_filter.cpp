@@ -0,0 +1,150 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! turma_filtra: confere detail::select_at_least contra um laco simples
+//! (tamanhos que nao enchem um grupo SIMD, limites INT_MIN/INT_MAX) e as
+//! versoes de Roster contra as de alocacao-parte2.cpp (a de 3 argumentos
+//! com uma unica alocacao, a da saida); depois mede a selecao em 10M
+//! matriculas com 1%, 50% e 99% selecionados, e o filtro completo com 1M
+//! alunos.
+//!
+//!     g++ -std=c++17 -O2 -march=native bench_filter.cpp -o bench_filter
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#define STRUCTURES_COUNT_ALLOCATIONS  // operator new contado, so aqui
+#include "./allocation_counter.h"
+#include "./alocacao-parte2.cpp"
+#include "./roster.h"
+
+std::size_t select_loop(const std::int32_t* keys, std::size_t n,
+                        std::int32_t min, std::uint32_t* out) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        if (keys[i] >= min) {
+            out[count++] = static_cast<std::uint32_t>(i);
+        }
+    }
+    return count;
+}
+
+void check() {
+    std::mt19937 rng(41);
+    for (int round = 0; round < 5000; round++) {
+        std::size_t n = rng() % 100;
+        std::vector<std::int32_t> keys(n);
+        for (auto& k : keys) {
+            k = round % 3 == 0 ? static_cast<std::int32_t>(rng()) :
+                static_cast<std::int32_t>(rng() % 20) - 10;
+        }
+        std::int32_t min = round % 7 == 0 ? INT_MIN :
+                           round % 7 == 1 ? INT_MAX :
+                           static_cast<std::int32_t>(rng() % 20) - 10;
+        std::vector<std::uint32_t> got(n + 1), expected(n + 1);
+        std::size_t count = structures::detail::select_at_least(
+            keys.data(), n, min, got.data());
+        assert(count == select_loop(keys.data(), n, min, expected.data()));
+        got.resize(count);
+        expected.resize(count);
+        assert(got == expected);
+    }
+
+    for (int round = 0; round < 300; round++) {
+        int N = rng() % 300;
+        std::vector<std::string> nomes(N);
+        std::vector<int> matriculas(N);
+        structures::Roster r;
+        Aluno* t = new Aluno[N];
+        for (int i = 0; i < N; i++) {
+            nomes[i] = "Aluno" + std::to_string(rng() % 1000);
+            matriculas[i] = static_cast<int>(rng() % 1000);
+            r.push_back(nomes[i], matriculas[i]);
+            t[i].escreveNome(nomes[i]);
+            t[i].escreveMatricula(matriculas[i]);
+        }
+        int menor = static_cast<int>(rng() % 1100);
+        structures::AllocationScope scope;
+        Aluno* tf = turma_filtra(t, N, menor);
+        // so a saida (nomes curtos cabem no SSO); 0 sob ASan, que usa o
+        // proprio operator new
+        assert(scope.allocations() <= 1);
+        Aluno* saida = new Aluno[N];
+        int size = turma_filtra(t, N, menor, saida);
+        structures::Roster rf = structures::turma_filtra(r, menor);
+        assert(rf.size() == static_cast<std::size_t>(size));
+        for (int i = 0; i < size; i++) {
+            assert(rf.nome(i) == tf[i].devolveNome());
+            assert(rf.nome(i) == saida[i].devolveNome());
+            assert(rf.matricula(i) == tf[i].devolveMatricula());
+        }
+        bool threw = false;
+        try {
+            structures::turma_filtra(r, menor, r);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+        delete[] t;
+        delete[] tf;
+        delete[] saida;
+    }
+    std::printf("turma_filtra: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check();
+    std::mt19937 rng(1);
+    const std::size_t n = 10000000;
+    std::vector<std::int32_t> keys(n);
+    for (auto& k : keys) {
+        k = static_cast<std::int32_t>(rng() % 1000);
+    }
+    std::vector<std::uint32_t> out(n);
+    for (int percent : {1, 50, 99}) {
+        std::int32_t min = 1000 - percent * 10;
+        std::size_t counts[2];
+        double loop = seconds([&] {
+            counts[0] = select_loop(keys.data(), n, min, out.data());
+        });
+        double simd = seconds([&] {
+            counts[1] = structures::detail::select_at_least(
+                keys.data(), n, min, out.data());
+        });
+        assert(counts[0] == counts[1]);
+        std::printf("selecao %2d%%: laco %6.2f ms  select_at_least %6.2f ms\n",
+                    percent, loop * 1e3, simd * 1e3);
+    }
+
+    const int N = 1000000;
+    structures::Roster r;
+    Aluno* t = new Aluno[N];
+    for (int i = 0; i < N; i++) {
+        std::string nome = "Aluno " + std::to_string(rng() % 100000);
+        int matricula = static_cast<int>(rng() % 1000);
+        r.push_back(nome, matricula);
+        t[i].escreveNome(nome);
+        t[i].escreveMatricula(matricula);
+    }
+    Aluno* tf = nullptr;
+    structures::Roster rf;
+    double aluno = seconds([&] { tf = turma_filtra(t, N, 500); });
+    double roster = seconds([&] { structures::turma_filtra(r, 500, rf); });
+    std::printf("turma_filtra 50%% de %d: Aluno[] %.1f ms  Roster %.1f ms\n",
+                N, aluno * 1e3, roster * 1e3);
+    delete[] t;
+    delete[] tf;
+    return 0;
+}
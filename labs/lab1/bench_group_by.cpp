@@ -0,0 +1,126 @@
+// Copyright [2024] <Luan da Silva Moraes>
+//! grupos_por_iniciais e structures::group_by: confere a versao de vetor
+//! unico (copia, com a entrada intacta, e movendo) contra a original de 26
+//! vetores, com nomes fora de 'A'-'Z', 1 e 4 threads e o vetor de saida com
+//! o tamanho exato; depois mede as tres versoes com 1M alunos.
+//!
+//!     g++ -std=c++17 -O2 -pthread bench_group_by.cpp -o bench_group_by
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./alocacao-parte3.cpp"
+
+std::vector<Aluno> random_turma(std::mt19937& rng, std::size_t n) {
+    std::vector<Aluno> t(n);
+    for (std::size_t i = 0; i < n; i++) {
+        std::string nome;
+        std::size_t length = rng() % 30;  // inclui vazios e nomes sem SSO
+        for (std::size_t k = 0; k < length; k++) {
+            nome += static_cast<char>(k == 0 ? 'A' - 2 + rng() % 30 :
+                                               'a' + rng() % 26);
+        }
+        t[i].escreveNome(nome);
+        t[i].escreveMatricula(static_cast<int>(i));
+    }
+    return t;
+}
+
+void check() {
+    std::mt19937 rng(42);
+    for (int round = 0; round < 40; round++) {
+        std::size_t n = round < 30 ? rng() % 500 : 70000 + rng() % 1000;
+        std::vector<Aluno> t = random_turma(rng, n);
+        std::vector<Aluno> original = t;
+        int N = static_cast<int>(n);
+        Aluno** g = grupos_por_iniciais(t.data(), N);
+        int* c = turma_conta(t.data(), N);
+        for (unsigned threads : {1u, 4u}) {
+            std::size_t offsets[27];
+            Aluno* unico = grupos_por_iniciais(t.data(), N, offsets, threads);
+            std::size_t total = 0;
+            for (int letter = 0; letter < 26; letter++) {
+                assert(offsets[letter] == total);
+                assert(offsets[letter + 1] - offsets[letter] ==
+                       static_cast<std::size_t>(c[letter]));
+                for (int k = 0; k < c[letter]; k++) {
+                    const Aluno& a = unico[offsets[letter] + k];
+                    assert(a.devolveNome() == g[letter][k].devolveNome());
+                }
+                total += c[letter];
+            }
+            assert(offsets[26] == total);
+            for (std::size_t i = 0; i < n; i++) {  // entrada intacta
+                assert(t[i].devolveNome() == original[i].devolveNome());
+            }
+            delete[] unico;
+        }
+        std::vector<Aluno> moved = t;
+        std::size_t offsets[27];
+        Aluno* unico = grupos_por_iniciais_movendo(moved.data(), N, offsets,
+                                                   4);
+        for (int letter = 0; letter < 26; letter++) {
+            for (int k = 0; k < c[letter]; k++) {
+                assert(unico[offsets[letter] + k].devolveNome() ==
+                       g[letter][k].devolveNome());
+            }
+        }
+        delete[] unico;
+        for (int letter = 0; letter < 26; letter++) {
+            delete[] g[letter];
+        }
+        delete[] g;
+        delete[] c;
+
+        // Buckets com entrada const: copia, e so do tamanho dos grupos
+        const Aluno* entrada = t.data();
+        auto groups = structures::group_by(entrada, n, 26, inicial, 2);
+        assert(groups.items.size() == groups.offsets[26]);
+        assert(t.size() == original.size());
+    }
+    std::printf("grupos_por_iniciais: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check();
+    std::mt19937 rng(1);
+    const int N = 1000000;
+    std::vector<Aluno> t = random_turma(rng, N);
+    Aluno** g = nullptr;
+    double original = seconds([&] { g = grupos_por_iniciais(t.data(), N); });
+    for (int letter = 0; letter < 26; letter++) {
+        delete[] g[letter];
+    }
+    delete[] g;
+    std::printf("%d alunos\n26 vetores (original)     %7.1f ms\n", N,
+                original * 1e3);
+    for (unsigned threads : {1u, 4u}) {
+        std::size_t offsets[27];
+        Aluno* unico = nullptr;
+        double copy = seconds([&] {
+            unico = grupos_por_iniciais(t.data(), N, offsets, threads);
+        });
+        delete[] unico;
+        std::vector<Aluno> moved = t;
+        double move = seconds([&] {
+            unico = grupos_por_iniciais_movendo(moved.data(), N, offsets,
+                                                threads);
+        });
+        delete[] unico;
+        std::printf("vetor unico, %u thread(s): copia %7.1f ms  "
+                    "movendo %7.1f ms\n", threads, copy * 1e3, move * 1e3);
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! histogram e byte_histogram: confere contra um laco simples (politicas
+//! IGNORE/CLAMP/THROW, chaves negativas, 1 a 4 threads, abaixo e acima do
+//! minimo para usar threads) e turma_conta de Roster contra a versao de
+//! alocacao-parte2.cpp; depois mede bytes aleatorios e bytes todos iguais
+//! (o caso em que um unico contador serializa os incrementos).
+//!
+//!     g++ -std=c++17 -O2 -pthread bench_histogram.cpp -o bench_histogram
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "./alocacao-parte2.cpp"
+#include "./roster.h"
+
+void check() {
+    std::mt19937 rng(43);
+    for (int round = 0; round < 60; round++) {
+        std::size_t n = round % 2 ? rng() % 1000 : 70000 + rng() % 5000;
+        std::size_t bins = 1 + rng() % 50;
+        std::vector<int> keys(n);
+        for (auto& k : keys) {
+            k = static_cast<int>(rng() % (bins + 10)) - 5;
+        }
+        auto key = [](int k) { return k; };
+        for (unsigned threads : {1u, 3u, 4u}) {
+            std::vector<std::size_t> ignore(bins, 0), clamp(bins, 0);
+            bool outside = false;
+            for (int k : keys) {
+                if (k >= 0 && k < static_cast<int>(bins)) {
+                    ignore[k]++;
+                    clamp[k]++;
+                } else {
+                    clamp[k < 0 ? 0 : bins - 1]++;
+                    outside = true;
+                }
+            }
+            assert(structures::histogram(keys.data(), n, bins, key,
+                       structures::OutOfRange::IGNORE, threads) == ignore);
+            assert(structures::histogram(keys.data(), n, bins, key,
+                       structures::OutOfRange::CLAMP, threads) == clamp);
+            bool threw = false;
+            try {
+                structures::histogram(keys.data(), n, bins, key,
+                                      structures::OutOfRange::THROW, threads);
+            } catch (const std::out_of_range&) {
+                threw = true;
+            }
+            assert(threw == outside);
+
+            std::vector<unsigned char> bytes(n);
+            std::array<std::size_t, 256> expected = {};
+            for (auto& b : bytes) {
+                b = round % 3 ? static_cast<unsigned char>(rng()) : 'x';
+                expected[b]++;
+            }
+            assert(structures::byte_histogram(bytes.data(), n, threads) ==
+                   expected);
+        }
+    }
+
+    for (int round = 0; round < 100; round++) {
+        int N = rng() % 300;
+        Aluno* t = new Aluno[N];
+        structures::Roster r;
+        for (int i = 0; i < N; i++) {
+            std::string nome;
+            if (rng() % 5) {  // alguns vazios
+                nome = std::string(1, static_cast<char>(rng() % 256)) + "x";
+            }
+            t[i].escreveNome(nome);
+            t[i].escreveMatricula(i);
+            r.push_back(nome, i);
+        }
+        int* c = turma_conta(t, N);
+        std::array<int, 26> rc = structures::turma_conta(r, 2);
+        for (int letter = 0; letter < 26; letter++) {
+            assert(c[letter] == rc[letter]);
+        }
+        delete[] c;
+        delete[] t;
+    }
+    std::printf("histogram: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check();
+    const std::size_t n = 256u << 20;
+    std::vector<unsigned char> random(n), same(n, 'A');
+    std::mt19937 rng(1);
+    for (auto& b : random) {
+        b = static_cast<unsigned char>(rng());
+    }
+    for (auto* data : {&random, &same}) {
+        const unsigned char* bytes = data->data();
+        std::array<std::size_t, 256> simple = {}, fast = {};
+        double loop = seconds([&] {
+            for (std::size_t i = 0; i < n; i++) {
+                simple[bytes[i]]++;
+            }
+        });
+        std::printf("%-16s laco %6.2f GB/s", data == &random ?
+                    "bytes aleatorios" : "bytes iguais", n / loop / 1e9);
+        for (unsigned threads : {1u, 4u}) {
+            double took = seconds([&] {
+                fast = structures::byte_histogram(bytes, n, threads);
+            });
+            assert(fast == simple);
+            std::printf("  %u thread(s) %6.2f GB/s", threads,
+                        n / took / 1e9);
+        }
+        std::printf("\n");
+    }
+    return 0;
+}
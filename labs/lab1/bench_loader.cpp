@@ -0,0 +1,227 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! load_roster_csv: confere parse_roster_csv contra uma leitura linha a
+//! linha (virgulas no nome, "\r\n", linhas vazias, cabecalho, ultima linha
+//! sem quebra, matriculas nos limites de int32, 1 e 4 threads acima do
+//! minimo para dividir o texto), as linhas invalidas e a ida e volta por
+//! save_roster_csv; depois grava um CSV grande (argv[1] alunos, 5M por
+//! padrao) e mede a vazao e o pico de memoria do carregamento contra
+//! getline + turma() de alocacao-parte1.cpp.
+//!
+//!     g++ -std=c++17 -O2 -march=native -pthread bench_loader.cpp -o bench
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "./alocacao-parte1.cpp"
+#include "./roster_loader.h"
+
+struct Row {
+    std::string nome;
+    std::int32_t matricula;
+};
+
+//! leitura de referencia: uma linha por vez, sem SIMD nem threads
+std::vector<Row> reference(const std::string& text, bool header) {
+    std::vector<Row> rows;
+    std::size_t begin = 0;
+    bool skip = header;
+    while (begin < text.size()) {
+        std::size_t end = text.find('\n', begin);
+        end = end == std::string::npos ? text.size() : end;
+        std::string line = text.substr(begin, end - begin);
+        begin = end + 1;
+        if (skip) {
+            skip = false;
+            continue;
+        }
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            continue;
+        }
+        std::size_t comma = line.rfind(',');
+        if (comma == std::string::npos) {
+            throw std::runtime_error("sem virgula");
+        }
+        std::string number = line.substr(comma + 1);
+        std::size_t first = number.find_first_not_of(' ');
+        std::size_t last = number.find_last_not_of(' ');
+        if (first == std::string::npos) {
+            throw std::runtime_error("sem matricula");
+        }
+        number = number.substr(first, last - first + 1);
+        std::size_t digits = number[0] == '-' || number[0] == '+';
+        if (digits == number.size() ||
+            number.find_first_not_of("0123456789", digits) !=
+                std::string::npos || number.size() > 12) {
+            throw std::runtime_error("matricula invalida");
+        }
+        long long value = std::stoll(number);
+        if (value > INT32_MAX || value < INT32_MIN) {
+            throw std::runtime_error("matricula fora de int32");
+        }
+        rows.push_back({line.substr(0, comma),
+                        static_cast<std::int32_t>(value)});
+    }
+    return rows;
+}
+
+std::string random_csv(std::mt19937& rng, std::size_t n, bool invalid) {
+    const char* matriculas[] = {"0", "-1", "+7", " 42 ", "2147483647",
+                                "-2147483648", "00012"};
+    const char* wrong[] = {"", "x", "2147483648", "-2147483649", "1 2",
+                           "99999999999999999999", "-"};
+    std::string text;
+    for (std::size_t i = 0; i < n; i++) {
+        std::size_t length = rng() % 40;  // inclui nomes vazios
+        for (std::size_t k = 0; k < length; k++) {
+            text += "abc, xyz"[rng() % 8];  // virgulas dentro do nome
+        }
+        text += ',';
+        if (invalid && i == n / 2) {
+            text += wrong[rng() % 7];
+        } else if (rng() % 4 == 0) {
+            text += matriculas[rng() % 7];
+        } else {
+            text += std::to_string(static_cast<std::int32_t>(rng()));
+        }
+        switch (rng() % 8) {
+            case 0: text += "\r\n"; break;
+            case 1: text += "\n\n"; break;  // linha vazia
+            default: text += '\n';
+        }
+    }
+    if (n > 0 && rng() % 2) {
+        text.pop_back();  // ultima linha sem quebra
+    }
+    return text;
+}
+
+void check() {
+    std::mt19937 rng(45);
+    for (int round = 0; round < 200; round++) {
+        bool big = round % 10 == 0;  // acima de BUCKET_PARALLEL_MIN_SIZE
+        std::size_t n = big ? 5000 + rng() % 1000 : rng() % 50;
+        bool header = rng() % 2;
+        bool invalid = n > 0 && round % 5 == 1;
+        std::string text = random_csv(rng, n, invalid);
+        if (header) {
+            text = "nome,matricula\n" + text;
+        }
+        std::vector<Row> expected;
+        bool reference_threw = false;
+        try {
+            expected = reference(text, header);
+        } catch (const std::runtime_error&) {
+            reference_threw = true;
+        }
+        for (unsigned threads : {1u, 4u}) {
+            structures::Roster t;
+            bool threw = false;
+            try {
+                t = structures::parse_roster_csv(text, threads, header);
+            } catch (const std::runtime_error&) {
+                threw = true;
+            }
+            assert(threw == reference_threw);
+            if (threw) {
+                continue;
+            }
+            assert(t.size() == expected.size());
+            for (std::size_t i = 0; i < t.size(); i++) {
+                assert(t.nome(i) == expected[i].nome);
+                assert(t.matricula(i) == expected[i].matricula);
+            }
+        }
+        if (!reference_threw && round % 20 == 0) {
+            structures::Roster t = structures::parse_roster_csv(text, 2,
+                                                                header);
+            structures::save_roster_csv(t, "/tmp/bench_loader_check.csv");
+            structures::Roster back = structures::load_roster_csv(
+                "/tmp/bench_loader_check.csv", 2);
+            assert(back.size() == t.size());
+            for (std::size_t i = 0; i < t.size(); i++) {
+                assert(back.nome(i) == t.nome(i));
+                assert(back.matricula(i) == t.matricula(i));
+            }
+        }
+    }
+    std::remove("/tmp/bench_loader_check.csv");
+    bool threw = false;
+    try {
+        structures::load_roster_csv("/tmp/bench_loader_nao_existe.csv");
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    std::printf("load_roster_csv: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main(int argc, char** argv) {
+    check();
+    const int N = argc > 1 ? std::atoi(argv[1]) : 5000000;
+    const char* path = "/tmp/bench_loader.csv";
+    {
+        std::mt19937 rng(1);
+        structures::Roster t;
+        for (int i = 0; i < N; i++) {
+            std::string nome = "Aluno " + std::to_string(rng() % 1000000) +
+                               std::string(rng() % 16, 'x');
+            t.push_back(nome, static_cast<std::int32_t>(rng() % 100000000));
+        }
+        structures::save_roster_csv(t, path);
+    }
+    std::printf("pico depois de gerar o arquivo: %zu MB\n",
+                structures::peak_rss_bytes() >> 20);
+
+    // o pico de memoria so cresce: o carregador vem antes da referencia
+    for (unsigned threads : {1u, 4u}) {
+        structures::LoadStats stats;
+        structures::Roster t = structures::load_roster_csv(path, threads,
+                                                           false, &stats);
+        assert(t.size() == static_cast<std::size_t>(N));
+        std::printf("load_roster_csv, %u thread(s): %zu alunos, %.0f MB, "
+                    "%.2f GB/s, pico %zu MB\n", threads, stats.rows,
+                    stats.bytes / 1e6, stats.gigabytes_per_second(),
+                    stats.peak_rss >> 20);
+    }
+
+    std::size_t bytes = 0;
+    Aluno* t = nullptr;
+    double took = seconds([&] {
+        std::ifstream input(path);
+        std::vector<std::string> nomes;
+        std::vector<int> matriculas;
+        std::string line;
+        while (std::getline(input, line)) {
+            bytes += line.size() + 1;
+            std::size_t comma = line.rfind(',');
+            nomes.push_back(line.substr(0, comma));
+            matriculas.push_back(std::stoi(line.substr(comma + 1)));
+        }
+        t = turma(nomes.data(), matriculas.data(), N);
+    });
+    std::printf("getline + turma():            %d alunos, %.0f MB, "
+                "%.2f GB/s, pico %zu MB\n", N, bytes / 1e6,
+                bytes / took / 1e9, structures::peak_rss_bytes() >> 20);
+    delete[] t;
+    std::remove(path);
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! Roster: confere as seis funcoes contra as versoes com vetor de Aluno
+//! (inclusive turmas_divisao com t1 ou t2 sendo a propria entrada e
+//! append de uma turma nela mesma) e mede turma, turmas_uniao e
+//! turmas_divisao com 1M alunos nas duas representacoes.
+//!
+//!     g++ -std=c++17 -O2 bench_roster.cpp -o bench_roster
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "./alocacao-parte1.cpp"
+#include "./roster.h"
+
+void same(structures::Roster& r, Aluno* t, int N) {
+    assert(r.size() == static_cast<std::size_t>(N));
+    for (int i = 0; i < N; i++) {
+        assert(r.nome(i) == t[i].devolveNome());
+        assert(r.matricula(i) == t[i].devolveMatricula());
+    }
+}
+
+std::vector<std::string> random_names(std::mt19937& rng, std::size_t n) {
+    std::vector<std::string> nomes(n);
+    for (auto& nome : nomes) {
+        std::size_t length = rng() % 24;  // inclui nomes vazios
+        for (std::size_t i = 0; i < length; i++) {
+            nome += static_cast<char>(i == 0 ? 'A' + rng() % 28 :
+                                               'a' + rng() % 26);
+        }
+    }
+    return nomes;
+}
+
+void check() {
+    std::mt19937 rng(40);
+    for (int round = 0; round < 300; round++) {
+        int N = rng() % 200;
+        std::vector<std::string> nomes = random_names(rng, N);
+        std::vector<int> matriculas(N);
+        for (auto& m : matriculas) {
+            m = static_cast<int>(rng() % 100000);
+        }
+        Aluno* t = turma(nomes.data(), matriculas.data(), N);
+        structures::Roster r = structures::turma(nomes.data(),
+                                                 matriculas.data(), N);
+        same(r, t, N);
+
+        Aluno* tu = turmas_uniao(t, t, N, N);
+        structures::Roster ru = structures::turmas_uniao(r, r);
+        same(ru, tu, 2 * N);
+
+        int k = N == 0 ? 0 : rng() % (N + 1);
+        Aluno *t1, *t2;
+        turmas_divisao(t, k, N, &t1, &t2);
+        structures::Roster r1, r2;
+        structures::turmas_divisao(r, k, r1, r2);
+        same(r1, t1, k);
+        same(r2, t2, N - k);
+
+        // saidas que sao a propria entrada
+        structures::Roster a = r, b;
+        structures::turmas_divisao(a, k, a, b);
+        same(a, t1, k);
+        same(b, t2, N - k);
+        a = r;
+        structures::turmas_divisao(a, k, b, a);
+        same(b, t1, k);
+        same(a, t2, N - k);
+        bool threw = false;
+        try {
+            structures::turmas_divisao(r, k, b, b);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+
+        // append de si mesma (inteira e um trecho), sem reserva previa
+        a = r;
+        a.append(a);
+        same(a, tu, 2 * N);
+        a = r;
+        a.append(a, k, N);
+        assert(a.size() == static_cast<std::size_t>(2 * N - k));
+        for (int i = 0; i < N; i++) {
+            assert(a.nome(i) == t[i].devolveNome());
+        }
+        for (int i = k; i < N; i++) {
+            assert(a.nome(N + i - k) == t[i].devolveNome());
+        }
+        std::vector<std::uint32_t> selection;
+        for (int i = N - 1; i >= 0; i -= 2) {
+            selection.push_back(i);
+        }
+        a = r;
+        a.append_selected(a, selection.data(), selection.size());
+        for (std::size_t j = 0; j < selection.size(); j++) {
+            assert(a.nome(N + j) == t[selection[j]].devolveNome());
+            assert(a.matricula(N + j) == t[selection[j]].devolveMatricula());
+        }
+
+        delete[] t;
+        delete[] tu;
+        delete[] t1;
+        delete[] t2;
+    }
+    std::printf("Roster: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check();
+    const int N = 1000000;
+    std::mt19937 rng(1);
+    std::vector<std::string> nomes = random_names(rng, N);
+    std::vector<int> matriculas(N);
+    for (auto& m : matriculas) {
+        m = static_cast<int>(rng());
+    }
+    Aluno *t = nullptr, *tu = nullptr, *t1 = nullptr, *t2 = nullptr;
+    structures::Roster r, ru, r1, r2;
+    double aluno[3], roster[3];
+    aluno[0] = seconds([&] { t = turma(nomes.data(), matriculas.data(), N); });
+    roster[0] = seconds([&] {
+        r = structures::turma(nomes.data(), matriculas.data(), N);
+    });
+    aluno[1] = seconds([&] { tu = turmas_uniao(t, t, N, N); });
+    roster[1] = seconds([&] { ru = structures::turmas_uniao(r, r); });
+    aluno[2] = seconds([&] { turmas_divisao(tu, N, 2 * N, &t1, &t2); });
+    roster[2] = seconds([&] { structures::turmas_divisao(ru, N, r1, r2); });
+    const char* names[] = {"turma", "turmas_uniao", "turmas_divisao"};
+    for (int i = 0; i < 3; i++) {
+        std::printf("%-15s Aluno[] %8.1f ms  Roster %8.1f ms\n", names[i],
+                    aluno[i] * 1e3, roster[i] * 1e3);
+    }
+    std::printf("bytes por aluno: Aluno[] %zu + nome fora do SSO; "
+                "Roster %.1f\n", sizeof(Aluno),
+                (r.size() * 8.0 + r.name_size()) / r.size());
+    delete[] t;
+    delete[] tu;
+    delete[] t1;
+    delete[] t2;
+    return 0;
+}
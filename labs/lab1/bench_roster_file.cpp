@@ -0,0 +1,191 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! MappedRoster: confere a ida e volta por save_roster_columns (com e sem
+//! indice, turmas vazias), turma_filtra, turma_conta e os grupos por
+//! inicial contra a Roster de origem, e que cabecalhos corrompidos sao
+//! recusados ao abrir, inclusive deslocamentos perto de 2^64 cuja soma
+//! daria a volta; depois compara o tempo de partida com argv[1] alunos
+//! (5M por padrao): ler o CSV contra mapear o arquivo em colunas.
+//!
+//!     g++ -std=c++17 -O2 -march=native -pthread bench_roster_file.cpp -o bench
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "./roster_file.h"
+
+structures::Roster random_roster(std::mt19937& rng, std::size_t n) {
+    structures::Roster r;
+    for (std::size_t i = 0; i < n; i++) {
+        std::string nome;
+        std::size_t length = rng() % 20;  // inclui vazios e fora de 'A'-'Z'
+        for (std::size_t k = 0; k < length; k++) {
+            nome += static_cast<char>(k == 0 ? 'A' - 3 + rng() % 32 :
+                                               'a' + rng() % 26);
+        }
+        r.push_back(nome, static_cast<std::int32_t>(rng() % 20000) - 10000);
+    }
+    return r;
+}
+
+std::string read_file(const char* path) {
+    std::ifstream input(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(input),
+                       std::istreambuf_iterator<char>());
+}
+
+void write_file(const char* path, const std::string& bytes) {
+    std::ofstream output(path, std::ios::binary);
+    output.write(bytes.data(), bytes.size());
+}
+
+//! grava 'bytes' com o campo de 8 bytes em 'field' trocado e tenta abrir
+bool rejected(const char* path, std::string bytes, std::size_t field,
+              std::uint64_t value) {
+    std::memcpy(&bytes[field], &value, sizeof(value));
+    write_file(path, bytes);
+    try {
+        structures::MappedRoster t(path);
+        t.verify();
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+void check() {
+    const char* path = "/tmp/bench_roster_file_check.bin";
+    std::mt19937 rng(46);
+    for (int round = 0; round < 100; round++) {
+        std::size_t n = round == 0 ? 0 : rng() % 2000;
+        structures::Roster r = random_roster(rng, n);
+        bool indexed = round % 3 != 0;
+        structures::save_roster_columns(r, path, indexed);
+        structures::MappedRoster t(path);
+        t.verify();
+        assert(t.size() == r.size());
+        assert(t.has_initial_index() == indexed);
+        for (std::size_t i = 0; i < n; i++) {
+            assert(t.nome(i) == r.nome(i));
+            assert(t.matricula(i) == r.matricula(i));
+        }
+        structures::Roster copy = t.to_roster();
+        assert(copy.size() == n && copy.name_size() == r.name_size());
+        assert(structures::turma_conta(t) == structures::turma_conta(r));
+
+        int menor = static_cast<int>(rng() % 20000) - 10000;
+        std::vector<std::uint32_t> got(n + 1), expected(n + 1);
+        std::size_t count = structures::turma_filtra(t, menor, got.data());
+        assert(count == structures::detail::select_at_least(
+            r.matriculas(), n, menor, expected.data()));
+        got.resize(count);
+        expected.resize(count);
+        assert(got == expected);
+
+        if (indexed) {
+            for (int l = 0; l < 26; l++) {
+                std::size_t size;
+                const std::uint32_t* rows = t.initial_group(l, size);
+                std::vector<std::uint32_t> group;
+                for (std::size_t i = 0; i < n; i++) {
+                    if (!r.nome(i).empty() && r.nome(i)[0] == 'A' + l) {
+                        group.push_back(static_cast<std::uint32_t>(i));
+                    }
+                }
+                assert(std::vector<std::uint32_t>(rows, rows + size) ==
+                       group);
+            }
+        } else {
+            bool threw = false;
+            std::size_t size;
+            try {
+                t.initial_group(0, size);
+            } catch (const std::out_of_range&) {
+                threw = true;
+            }
+            assert(threw);
+        }
+    }
+
+    // cabecalhos corrompidos: campos a partir do byte 16 (flags)
+    structures::Roster r = random_roster(rng, 500);
+    structures::save_roster_columns(r, path, true);
+    std::string bytes = read_file(path);
+    const std::size_t COUNT = 24, NAME_BYTES = 32, MATRICULAS = 40,
+                      OFFSETS = 48, NAMES = 56, INDEX = 64;
+    const std::uint64_t NEAR_END = ~std::uint64_t(0) - 63;  // 2^64 - 64
+    assert(rejected(path, bytes, COUNT, 501));
+    assert(rejected(path, bytes, COUNT, ~std::uint64_t(0)));
+    assert(rejected(path, bytes, NAME_BYTES, ~std::uint64_t(0)));
+    assert(rejected(path, bytes, MATRICULAS, NEAR_END));
+    assert(rejected(path, bytes, OFFSETS, NEAR_END));
+    assert(rejected(path, bytes, NAMES, NEAR_END));  // soma daria a volta
+    assert(rejected(path, bytes, INDEX, NEAR_END));
+    assert(rejected(path, bytes, INDEX, 64));
+    assert(rejected(path, bytes, 0, 0));  // magic
+    write_file(path, bytes.substr(0, bytes.size() - 1));
+    bool threw = false;
+    try {
+        structures::MappedRoster t(path);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    std::remove(path);
+    std::printf("MappedRoster: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main(int argc, char** argv) {
+    check();
+    const std::size_t N = argc > 1 ? std::atoi(argv[1]) : 5000000;
+    const char* csv = "/tmp/bench_roster_file.csv";
+    const char* columns = "/tmp/bench_roster_file.bin";
+    {
+        std::mt19937 rng(1);
+        structures::Roster r = random_roster(rng, N);
+        structures::save_roster_csv(r, csv);
+        structures::save_roster_columns(r, columns);
+    }
+
+    std::size_t sizes[2];
+    double parse = seconds([&] {
+        sizes[0] = structures::load_roster_csv(csv).size();
+    });
+    double open = 0, verify = 0, query = 0;
+    std::vector<std::uint32_t> selection(N);
+    std::size_t selected = 0;
+    open = seconds([&] {
+        structures::MappedRoster t(columns);
+        sizes[1] = t.size();
+        query = seconds([&] {
+            selected = structures::turma_filtra(t, 0, selection.data());
+        });
+        verify = seconds([&] { t.verify(); });
+    });
+    open -= query + verify;
+    assert(sizes[0] == N && sizes[1] == N);
+    std::printf("%zu alunos: ler CSV %.1f ms  abrir em colunas %.3f ms\n"
+                "turma_filtra no arquivo mapeado %.1f ms (%zu alunos), "
+                "verify %.1f ms\n", N, parse * 1e3, open * 1e3, query * 1e3,
+                selected, verify * 1e3);
+    std::remove(csv);
+    std::remove(columns);
+    return 0;
+}
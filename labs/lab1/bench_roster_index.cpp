@@ -0,0 +1,171 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! RosterIndex: confere insercoes, remocoes e buscas aleatorias contra
+//! std::unordered_map (chaves negativas, INT_MIN/INT_MAX, muitas colisoes
+//! na mesma faixa), build com matriculas repetidas (vale a primeira), a
+//! busca em lote contra a busca pontual e reserve sem crescer; depois mede
+//! buscas por segundo (metade presentes) contra a varredura linear e
+//! std::unordered_map, com 10K e 10M matriculas.
+//!
+//!     g++ -std=c++17 -O2 bench_roster_index.cpp -o bench_roster_index
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "./roster_index.h"
+
+void check() {
+    std::mt19937 rng(48);
+    for (int round = 0; round < 200; round++) {
+        structures::RosterIndex index;
+        std::unordered_map<std::int32_t, std::uint32_t> map;
+        std::int32_t range = round % 2 ? 64 : 100000;  // faixa pequena
+        for (int op = 0; op < 3000; op++) {
+            std::int32_t key = op % 97 == 0 ? (op % 2 ? INT_MIN : INT_MAX) :
+                static_cast<std::int32_t>(rng() % range) - range / 2;
+            std::uint32_t position = rng() % 1000;
+            switch (rng() % 4) {
+                case 0:
+                case 1:
+                    assert(index.insert(key, position) ==
+                           map.emplace(key, position).second);
+                    break;
+                case 2:
+                    assert(index.erase(key) == (map.erase(key) == 1));
+                    break;
+                default: {
+                    auto found = map.find(key);
+                    assert(index.find(key) == (found == map.end() ?
+                           structures::RosterIndex::NOT_FOUND :
+                           found->second));
+                    assert(index.contains(key) == (found != map.end()));
+                }
+            }
+            assert(index.size() == map.size());
+        }
+        for (const auto& entry : map) {
+            assert(index.find(entry.first) == entry.second);
+        }
+
+        std::size_t n = rng() % 5000;
+        std::vector<std::int32_t> matriculas(n);
+        for (auto& m : matriculas) {
+            m = static_cast<std::int32_t>(rng() % (n + 1)) - 100;  // repete
+        }
+        structures::RosterIndex built(matriculas.data(), n);
+        std::unordered_map<std::int32_t, std::uint32_t> first;
+        for (std::size_t i = 0; i < n; i++) {
+            first.emplace(matriculas[i], static_cast<std::uint32_t>(i));
+        }
+        assert(built.size() == first.size());
+        std::vector<std::int32_t> keys(n + 50);
+        for (auto& k : keys) {
+            k = static_cast<std::int32_t>(rng() % (2 * n + 2)) - 100;
+        }
+        std::vector<std::uint32_t> out(keys.size());
+        built.find(keys.data(), keys.size(), out.data());
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            auto found = first.find(keys[i]);
+            assert(out[i] == built.find(keys[i]));
+            assert(out[i] == (found == first.end() ?
+                   structures::RosterIndex::NOT_FOUND : found->second));
+        }
+
+        structures::RosterIndex reserved;
+        reserved.reserve(n);
+        std::size_t capacity = reserved.capacity();
+        for (std::size_t i = 0; i < n; i++) {
+            reserved.insert(static_cast<std::int32_t>(i),
+                            static_cast<std::uint32_t>(i));
+        }
+        assert(reserved.capacity() == capacity);
+        reserved.clear();
+        assert(reserved.empty() && !reserved.contains(0));
+    }
+    std::printf("RosterIndex: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check();
+    std::mt19937 rng(1);
+    for (std::size_t n : {10000u, 10000000u}) {
+        std::vector<std::int32_t> matriculas(n);
+        for (auto& m : matriculas) {
+            m = static_cast<std::int32_t>(rng() & 0x7FFFFFFE);  // pares
+        }
+        const std::size_t queries = 1000000;
+        std::vector<std::int32_t> keys(queries);
+        for (auto& k : keys) {  // metade presentes, metade impares
+            k = rng() % 2 ? matriculas[rng() % n] :
+                static_cast<std::int32_t>(rng() | 1);
+        }
+
+        structures::RosterIndex index;
+        std::unordered_map<std::int32_t, std::uint32_t> map;
+        double build[2];
+        build[0] = seconds([&] { index.build(matriculas.data(), n); });
+        build[1] = seconds([&] {
+            map.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                map.emplace(matriculas[i], static_cast<std::uint32_t>(i));
+            }
+        });
+
+        std::size_t hits[4] = {0, 0, 0, 0};
+        std::size_t scanned = 1000000000 / n;  // varredura: poucas buscas
+        double took[4];
+        took[0] = seconds([&] {
+            for (std::size_t q = 0; q < scanned; q++) {
+                for (std::size_t i = 0; i < n; i++) {
+                    if (matriculas[i] == keys[q]) {
+                        hits[0]++;
+                        break;
+                    }
+                }
+            }
+        });
+        took[1] = seconds([&] {
+            for (std::int32_t k : keys) {
+                hits[1] += map.find(k) != map.end();
+            }
+        });
+        took[2] = seconds([&] {
+            for (std::int32_t k : keys) {
+                hits[2] += index.find(k) != structures::RosterIndex::NOT_FOUND;
+            }
+        });
+        std::vector<std::uint32_t> out(queries);
+        took[3] = seconds([&] {
+            index.find(keys.data(), queries, out.data());
+        });
+        for (std::uint32_t position : out) {
+            hits[3] += position != structures::RosterIndex::NOT_FOUND;
+        }
+        std::size_t expected = 0;
+        for (std::size_t q = 0; q < scanned; q++) {
+            expected += out[q] != structures::RosterIndex::NOT_FOUND;
+        }
+        assert(hits[0] == expected);
+        assert(hits[1] == hits[2] && hits[2] == hits[3]);
+        std::printf("%zu matriculas: build %.1f ms (unordered_map %.1f ms)\n",
+                    n, build[0] * 1e3, build[1] * 1e3);
+        std::printf("  milhoes de buscas/s: varredura %.3g  unordered_map "
+                    "%.3g  find %.3g  find em lote %.3g\n",
+                    scanned / took[0] / 1e6, queries / took[1] / 1e6,
+                    queries / took[2] / 1e6, queries / took[3] / 1e6);
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! RosterView e RosterRope: confere vistas, subvistas, divisao, uniao (de
+//! vistas e de concatenacoes, inclusive de uma concatenacao com ela mesma)
+//! e materialize contra as funcoes de Roster, que copiam; depois mede
+//! dividir e unir 1M alunos com e sem copia, e o custo do acesso por posicao
+//! numa concatenacao de muitos pedacos. Vistas de Roster temporarias nao
+//! devem compilar (static_assert).
+//!
+//!     g++ -std=c++17 -O2 bench_roster_view.cpp -o bench_roster_view
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "./roster.h"
+#include "./roster_view.h"
+
+// lvalue vira vista implicitamente; temporario nao vira de jeito nenhum
+static_assert(std::is_convertible<structures::Roster&,
+                                  structures::RosterView>::value, "");
+static_assert(!std::is_constructible<structures::RosterView,
+                                     structures::Roster>::value, "");
+static_assert(!std::is_constructible<structures::RosterView,
+                                     structures::Roster, std::size_t,
+                                     std::size_t>::value, "");
+
+template<typename Turma>
+void same(const Turma& got, const structures::Roster& expected) {
+    assert(got.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        assert(got.nome(i) == expected.nome(i));
+        assert(got.matricula(i) == expected.matricula(i));
+    }
+}
+
+structures::Roster random_roster(std::mt19937& rng, std::size_t n) {
+    structures::Roster r;
+    for (std::size_t i = 0; i < n; i++) {
+        std::string nome;
+        std::size_t length = rng() % 24;  // inclui nomes vazios
+        for (std::size_t k = 0; k < length; k++) {
+            nome += static_cast<char>('a' + rng() % 26);
+        }
+        r.push_back(nome, static_cast<int>(rng() % 100000));
+    }
+    return r;
+}
+
+void check() {
+    std::mt19937 rng(44);
+    for (int round = 0; round < 300; round++) {
+        std::size_t n = rng() % 200;
+        structures::Roster r = random_roster(rng, n);
+        structures::RosterView all(r);
+        same(all, r);
+        same(all.materialize(), r);
+
+        std::size_t k = rng() % (n + 1);
+        structures::RosterView v1, v2;
+        structures::turmas_divisao(all, k, v1, v2);
+        structures::Roster r1, r2;
+        structures::turmas_divisao(r, k, r1, r2);
+        same(v1, r1);
+        same(v2, r2);
+        assert(v1.name_size() == r1.name_size());
+        for (std::size_t i = 0; i < v1.size(); i++) {
+            assert(v1.matriculas()[i] == r1.matricula(i));
+        }
+
+        std::size_t begin = rng() % (n + 1);
+        std::size_t count = rng() % (n - begin + 1);
+        structures::RosterView sub = all.subview(begin, count);
+        structures::Roster rs, ignored;
+        structures::turmas_divisao(r, begin, ignored, rs);
+        structures::turmas_divisao(rs, count, rs, ignored);
+        same(sub, rs);
+
+        structures::RosterRope rope = structures::turmas_uniao(v2, v1);
+        structures::Roster ru = structures::turmas_uniao(r2, r1);
+        same(rope, ru);
+        same(rope.materialize(), ru);
+
+        // concatenacao com ela mesma, que precisa ler os pedacos antigos
+        rope.append(rope);
+        ru = structures::turmas_uniao(ru, ru);
+        same(rope, ru);
+        structures::RosterRope both = structures::turmas_uniao(rope, rope);
+        same(both, structures::turmas_uniao(ru, ru));
+
+        bool threw = false;
+        try {
+            rope.nome(rope.size());
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+        threw = false;
+        try {
+            structures::turmas_divisao(all, n + 1, v1, v2);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+    std::printf("RosterView: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check();
+    const std::size_t N = 1000000;
+    std::mt19937 rng(1);
+    structures::Roster r = random_roster(rng, N);
+
+    structures::Roster r1, r2, ru;
+    structures::RosterView v1, v2;
+    structures::RosterRope rope;
+    double copy[2], view[2];
+    copy[0] = seconds([&] { structures::turmas_divisao(r, N / 2, r1, r2); });
+    view[0] = seconds([&] {
+        structures::turmas_divisao(structures::RosterView(r), N / 2, v1, v2);
+    });
+    copy[1] = seconds([&] { ru = structures::turmas_uniao(r2, r1); });
+    view[1] = seconds([&] { rope = structures::turmas_uniao(v2, v1); });
+    const char* names[] = {"turmas_divisao", "turmas_uniao"};
+    for (int i = 0; i < 2; i++) {
+        std::printf("%-15s Roster %8.3f ms  vista %8.3f ms\n", names[i],
+                    copy[i] * 1e3, view[i] * 1e3);
+    }
+
+    // acesso por posicao: Roster contigua x concatenacao de 'pieces' pedacos
+    std::vector<std::size_t> positions(N);
+    for (auto& p : positions) {
+        p = rng() % N;
+    }
+    for (std::size_t pieces : {1u, 16u, 1024u}) {
+        structures::RosterRope chunks;
+        std::size_t step = N / pieces;
+        for (std::size_t i = 0; i < pieces; i++) {
+            chunks.append(structures::RosterView(r).subview(i * step, step));
+        }
+        std::size_t limit = chunks.size();  // step * pieces <= N
+        long long sums[2] = {0, 0};
+        double contiguous = seconds([&] {
+            for (std::size_t p : positions) {
+                sums[0] += r.matricula(p % limit);
+            }
+        });
+        double chunked = seconds([&] {
+            for (std::size_t p : positions) {
+                sums[1] += chunks.matricula(p % limit);
+            }
+        });
+        assert(sums[0] == sums[1]);
+        std::printf("%4zu pedaco(s): 1M matriculas  Roster %6.2f ms  "
+                    "concatenacao %6.2f ms\n", pieces, contiguous * 1e3,
+                    chunked * 1e3);
+    }
+    return 0;
+}
@@ -0,0 +1,178 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_BUCKETS_H
+#define STRUCTURES_BUCKETS_H
+
+#include <algorithm>  // std::max, std::min
+#include <cstdint>  // std::size_t
+#include <exception>  // std::exception_ptr
+#include <stdexcept>  // C++ exceptions
+#include <thread>  // std::thread
+#include <type_traits>  // std::remove_const_t
+#include <utility>  // std::move
+#include <vector>  // std::vector
+
+namespace structures {
+
+template<typename T>
+//! grupos guardados num unico vetor
+/*!
+    O grupo b ocupa items[offsets[b], offsets[b + 1]); há bucket_count() + 1
+    deslocamentos (27 para as iniciais 'A' a 'Z').
+*/
+struct Buckets {
+    std::vector<T> items;
+    std::vector<std::size_t> offsets;
+
+    //! metodo retorna a quantidade de grupos
+    std::size_t bucket_count() const {
+        return offsets.empty() ? 0 : offsets.size() - 1;
+    }
+    //! metodo retorna o inicio do grupo 'b'
+    T* bucket(std::size_t b) {
+        return items.data() + offsets[b];
+    }
+    //! metodo retorna o tamanho do grupo 'b'
+    std::size_t bucket_size(std::size_t b) const {
+        return offsets[b + 1] - offsets[b];
+    }
+};
+
+namespace detail {
+
+//! executa work(t) para t em [0, threads), a ultima na thread atual
+/*!
+    Uma exceção de qualquer work(t) é relançada depois de todos os joins
+    (a primeira, se houver várias).
+*/
+template<typename Work>
+void run_threads(unsigned threads, Work work) {
+    std::vector<std::exception_ptr> errors(threads);
+    auto guarded = [&](unsigned t) {
+        try {
+            work(t);
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> pool;
+    try {
+        for (unsigned t = 0; t + 1 < threads; t++) {
+            pool.emplace_back(guarded, t);
+        }
+    } catch (...) {
+        for (auto& thread : pool) {
+            thread.join();
+        }
+        throw;
+    }
+    guarded(threads - 1);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace detail
+
+//! abaixo disso os agrupamentos nao criam threads
+const std::size_t BUCKET_PARALLEL_MIN_SIZE = 1u << 16;
+
+//! agrupa items[0, n) por chave, por contagem (estavel)
+/*!
+    Um passo conta quantos itens caem em cada grupo; então allocate(total)
+    devolve a saída, com espaço exato para os itens não descartados, e
+    outro passo move cada item direto para a sua posição final nela (se
+    'items' for const Item*, os itens são copiados e a entrada fica
+    intacta). key(item) deve retornar um índice de grupo; itens com
+    chave >= buckets são descartados (nem contados nem movidos).
+    'offsets' recebe buckets + 1 posições. Retorna a saída.
+
+    Com várias threads, cada uma conta a sua faixa de itens num histograma
+    próprio; a soma de prefixos por (grupo, thread) dá a cada thread a sua
+    posição de escrita em cada grupo, então o segundo passo também é
+    paralelo e a ordem dentro de cada grupo é a ordem original.
+*/
+template<typename Item, typename Key, typename Allocate>
+auto group_by_alloc(Item* items, std::size_t n, std::size_t buckets, Key key,
+                    Allocate allocate, std::size_t* offsets,
+                    unsigned threads = 1) {
+    if (buckets == 0) {
+        throw std::out_of_range("quantidade de grupos invalida");
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (n < BUCKET_PARALLEL_MIN_SIZE) {
+        threads = 1;
+    }
+
+    std::size_t range = (n + threads - 1) / threads;
+    // histograms[t * buckets + b]: itens da thread t no grupo b
+    std::vector<std::size_t> histograms(threads * buckets, 0);
+    detail::run_threads(threads, [&](unsigned t) {
+        std::size_t* histogram = histograms.data() + t * buckets;
+        std::size_t end = std::min(n, (t + 1) * range);
+        for (std::size_t i = t * range; i < end; i++) {
+            std::size_t b = key(items[i]);
+            if (b < buckets) {
+                histogram[b]++;
+            }
+        }
+    });
+
+    // cada contador vira a posicao de escrita da thread no grupo
+    std::size_t position = 0;
+    for (std::size_t b = 0; b < buckets; b++) {
+        offsets[b] = position;
+        for (unsigned t = 0; t < threads; t++) {
+            std::size_t count = histograms[t * buckets + b];
+            histograms[t * buckets + b] = position;
+            position += count;
+        }
+    }
+    offsets[buckets] = position;
+
+    auto out = allocate(position);
+    detail::run_threads(threads, [&](unsigned t) {
+        std::size_t* next = histograms.data() + t * buckets;
+        std::size_t end = std::min(n, (t + 1) * range);
+        for (std::size_t i = t * range; i < end; i++) {
+            std::size_t b = key(items[i]);
+            if (b < buckets) {
+                out[next[b]++] = std::move(items[i]);
+            }
+        }
+    });
+    return out;
+}
+
+//! agrupa items[0, n) por chave em 'out' (com espaco para n itens)
+template<typename Item, typename T, typename Key>
+void group_by(Item* items, std::size_t n, std::size_t buckets, Key key,
+              T* out, std::size_t* offsets, unsigned threads = 1) {
+    group_by_alloc(items, n, buckets, key, [out](std::size_t) {
+        return out;
+    }, offsets, threads);
+}
+
+//! agrupa items[0, n) por chave num unico vetor (move, ou copia se const)
+template<typename Item, typename Key>
+Buckets<std::remove_const_t<Item>> group_by(Item* items, std::size_t n,
+                                            std::size_t buckets, Key key,
+                                            unsigned threads = 1) {
+    Buckets<std::remove_const_t<Item>> groups;
+    groups.offsets.resize(buckets + 1);
+    group_by_alloc(items, n, buckets, key, [&groups](std::size_t total) {
+        groups.items.resize(total);  // sem espaco para os descartados
+        return groups.items.data();
+    }, groups.offsets.data(), threads);
+    return groups;
+}
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,171 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_HISTOGRAM_H
+#define STRUCTURES_HISTOGRAM_H
+
+#include <algorithm>  // std::fill, std::min, std::max
+#include <array>  // std::array
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::int64_t, std::uint32_t
+#include <stdexcept>  // C++ exceptions
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include "./buckets.h"
+
+namespace structures {
+
+//! o que fazer com chaves fora de [0, bins)
+enum class OutOfRange {
+    IGNORE,  // nao conta
+    CLAMP,  // conta no primeiro ou no ultimo grupo
+    THROW  // lanca std::out_of_range
+};
+
+//! abaixo disso os histogramas nao criam threads
+const std::size_t HISTOGRAM_PARALLEL_MIN_SIZE = 1u << 16;
+
+//! conta items[0, n) em 'bins' grupos pela chave key(item)
+/*!
+    key deve retornar um inteiro (pode ser negativo). Cada thread conta uma
+    faixa de itens num histograma próprio, sem nenhuma escrita
+    compartilhada; os histogramas são somados no fim. Com OutOfRange::THROW
+    a exceção é lançada depois que todas as threads terminam.
+*/
+template<typename T, typename Key>
+std::vector<std::size_t> histogram(const T* items, std::size_t n,
+                                   std::size_t bins, Key key,
+                                   OutOfRange policy = OutOfRange::IGNORE,
+                                   unsigned threads = 1) {
+    if (bins == 0) {
+        throw std::out_of_range("quantidade de grupos invalida");
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (n < HISTOGRAM_PARALLEL_MIN_SIZE) {
+        threads = 1;
+    }
+
+    std::size_t range = (n + threads - 1) / threads;
+    std::vector<std::size_t> partial(threads * bins, 0);
+    std::atomic<bool> invalid{false};
+    detail::run_threads(threads, [&](unsigned t) {
+        std::size_t* counts = partial.data() + t * bins;
+        std::int64_t last = static_cast<std::int64_t>(bins) - 1;
+        std::size_t end = std::min(n, (t + 1) * range);
+        for (std::size_t i = t * range; i < end; i++) {
+            std::int64_t k = static_cast<std::int64_t>(key(items[i]));
+            if (k >= 0 && k <= last) {
+                counts[k]++;
+            } else if (policy == OutOfRange::CLAMP) {
+                counts[k < 0 ? 0 : last]++;
+            } else if (policy == OutOfRange::THROW) {
+                invalid = true;
+                return;
+            }
+        }
+    });
+    if (invalid) {
+        throw std::out_of_range("chave fora dos grupos");
+    }
+
+    std::vector<std::size_t> counts(bins, 0);
+    for (unsigned t = 0; t < threads; t++) {
+        for (std::size_t b = 0; b < bins; b++) {
+            counts[b] += partial[t * bins + b];
+        }
+    }
+    return counts;
+}
+
+namespace detail {
+
+//! conta bytes em 4 sub-histogramas intercalados
+/*!
+    Bytes iguais seguidos incrementariam o mesmo contador, e cada
+    incremento esperaria o anterior chegar à memória; alternando entre 4
+    cópias do histograma, incrementos vizinhos são independentes. Contadores
+    de 32 bits ocupam menos cache e são descarregados a cada 2^31 itens.
+*/
+template<typename ByteAt>
+void count_bytes(std::size_t begin, std::size_t end, ByteAt byte_at,
+                 std::size_t* counts) {
+    const std::size_t flush = std::size_t(1) << 31;
+    std::vector<std::uint32_t> sub(4 * 256);
+    while (begin < end) {
+        std::size_t stop = end - begin > flush ? begin + flush : end;
+        std::fill(sub.begin(), sub.end(), 0);
+        std::uint32_t* c0 = sub.data();
+        std::uint32_t* c1 = c0 + 256;
+        std::uint32_t* c2 = c1 + 256;
+        std::uint32_t* c3 = c2 + 256;
+        std::size_t i = begin;
+        for (; i + 4 <= stop; i += 4) {
+            c0[byte_at(i)]++;
+            c1[byte_at(i + 1)]++;
+            c2[byte_at(i + 2)]++;
+            c3[byte_at(i + 3)]++;
+        }
+        for (; i < stop; i++) {
+            c0[byte_at(i)]++;
+        }
+        for (int b = 0; b < 256; b++) {
+            counts[b] += std::size_t(c0[b]) + c1[b] + c2[b] + c3[b];
+        }
+        begin = stop;
+    }
+}
+
+//! histograma de 256 grupos de byte_at(i), i em [0, n), com 'threads'
+template<typename ByteAt>
+std::array<std::size_t, 256> byte_histogram(std::size_t n, ByteAt byte_at,
+                                            unsigned threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (n < HISTOGRAM_PARALLEL_MIN_SIZE) {
+        threads = 1;
+    }
+
+    std::size_t range = (n + threads - 1) / threads;
+    std::vector<std::array<std::size_t, 256>> partial(threads);
+    run_threads(threads, [&](unsigned t) {
+        partial[t].fill(0);
+        std::size_t begin = std::min(n, t * range);
+        count_bytes(begin, std::min(n, begin + range), byte_at,
+                    partial[t].data());
+    });
+
+    std::array<std::size_t, 256> counts = {};
+    for (unsigned t = 0; t < threads; t++) {
+        for (int b = 0; b < 256; b++) {
+            counts[b] += partial[t][b];
+        }
+    }
+    return counts;
+}
+
+}  // namespace detail
+
+//! histograma dos bytes de data[0, n)
+inline std::array<std::size_t, 256> byte_histogram(const unsigned char* data,
+                                                   std::size_t n,
+                                                   unsigned threads = 1) {
+    return detail::byte_histogram(n, [data](std::size_t i) {
+        return data[i];
+    }, threads);
+}
+
+//! histograma de uma chave de um byte, key(item), de items[0, n)
+template<typename T, typename ByteKey>
+std::array<std::size_t, 256> byte_histogram(const T* items, std::size_t n,
+                                            ByteKey key,
+                                            unsigned threads = 1) {
+    return detail::byte_histogram(n, [items, &key](std::size_t i) {
+        return static_cast<unsigned char>(key(items[i]));
+    }, threads);
+}
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,433 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ROSTER_H
+#define STRUCTURES_ROSTER_H
+
+#include <algorithm>  // std::copy
+#include <array>  // std::array
+#include <cstdint>  // std::int32_t, std::uint32_t
+#include <cstring>  // std::memcpy
+#include <stdexcept>  // C++ exceptions
+#include <string>  // std::string
+#include <string_view>  // std::string_view
+#include <utility>  // std::move
+#include <vector>  // std::vector
+
+#include "./histogram.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace structures {
+
+namespace detail {
+
+//! escreve em 'out' as posicoes i com keys[i] >= min; retorna quantas
+/*!
+    Compara 8 (AVX2) ou 4 (SSE2) chaves por instrução e percorre só os bits
+    da máscara resultante; grupos inteiramente selecionados são gravados de
+    uma vez. 'out' precisa de espaço para n posições.
+*/
+inline std::size_t select_at_least(const std::int32_t* keys, std::size_t n,
+                                   std::int32_t min, std::uint32_t* out) {
+    std::size_t count = 0;
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    __m256i bound = _mm256_set1_epi32(min);
+    __m256i positions = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+            keys + i));
+        unsigned below = static_cast<unsigned>(_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpgt_epi32(bound, v))));
+        if (below == 0) {  // todos selecionados: grava as 8 posicoes juntas
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(out + count),
+                _mm256_add_epi32(positions, _mm256_set1_epi32(
+                    static_cast<int>(i))));
+            count += 8;
+            continue;
+        }
+        for (unsigned bits = ~below & 0xFFu; bits != 0; bits &= bits - 1) {
+            out[count++] = static_cast<std::uint32_t>(
+                i + __builtin_ctz(bits));
+        }
+    }
+#elif defined(__SSE2__)
+    __m128i bound = _mm_set1_epi32(min);
+    __m128i positions = _mm_setr_epi32(0, 1, 2, 3);
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+            keys + i));
+        unsigned below = static_cast<unsigned>(_mm_movemask_ps(
+            _mm_castsi128_ps(_mm_cmpgt_epi32(bound, v))));
+        if (below == 0) {  // todos selecionados: grava as 4 posicoes juntas
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(out + count),
+                _mm_add_epi32(positions, _mm_set1_epi32(
+                    static_cast<int>(i))));
+            count += 4;
+            continue;
+        }
+        for (unsigned bits = ~below & 0xFu; bits != 0; bits &= bits - 1) {
+            out[count++] = static_cast<std::uint32_t>(
+                i + __builtin_ctz(bits));
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        // sem desvio: escreve sempre, avanca so se selecionado
+        out[count] = static_cast<std::uint32_t>(i);
+        count += keys[i] >= min;
+    }
+    return count;
+}
+
+}  // namespace detail
+
+//! CLASSE TURMA EM COLUNAS
+/*!
+    Guarda os mesmos dados de um vetor de Aluno, mas por coluna: as
+    matrículas ficam contíguas num vetor de int32, e os nomes ficam todos
+    num único buffer de caracteres (a arena), delimitados por um vetor de
+    deslocamentos (o nome i ocupa [offsets[i], offsets[i + 1]) ). Filtrar
+    por matrícula percorre só a coluna de matrículas; contar iniciais lê um
+    byte por nome, sem copiar nenhuma std::string.
+*/
+class Roster {
+ public:
+    //! construtor vazio
+    Roster();
+    //! metodo reserva espaco para 'students' alunos e 'name_bytes' bytes
+    void reserve(std::size_t students, std::size_t name_bytes);
+    //! metodo insere um aluno no fim
+    void push_back(std::string_view nome, std::int32_t matricula);
+    //! metodo acrescenta os alunos [begin, end) de 'other' no fim
+    void append(const Roster& other, std::size_t begin, std::size_t end);
+    //! metodo acrescenta todos os alunos de 'other' no fim
+    void append(const Roster& other);
+    //! metodo acrescenta os alunos de 'other' nas posicoes 'selection'
+    void append_selected(const Roster& other,
+                         const std::uint32_t* selection, std::size_t count);
+    //! metodo substitui o conteudo pelas colunas dadas, sem copia-las
+    /*!
+        offsets precisa ter matriculas.size() + 1 posições, começar em 0,
+        ser crescente e terminar em names.size().
+    */
+    void assign(std::vector<std::int32_t>&& matriculas,
+                std::vector<std::uint32_t>&& offsets,
+                std::vector<char>&& names);
+    //! metodo limpa a turma
+    void clear();
+    //! metodo retorna o nome do aluno 'index' (sem copiar)
+    std::string_view nome(std::size_t index) const;
+    //! metodo retorna a matricula do aluno 'index'
+    std::int32_t matricula(std::size_t index) const;
+    //! metodo retorna a coluna de matriculas
+    const std::int32_t* matriculas() const;
+    //! metodo retorna a arena de nomes
+    const char* name_bytes() const;
+    //! metodo retorna os deslocamentos dos nomes (size() + 1 posicoes)
+    const std::uint32_t* name_offsets() const;
+    //! metodo retorna o total de bytes dos nomes
+    std::size_t name_size() const;
+    //! metodo retorna a quantidade de alunos
+    std::size_t size() const;
+    //! metodo verifica se esta vazia
+    bool empty() const;
+
+ private:
+    //! verifica se a arena comporta mais 'bytes' bytes
+    void check_arena(std::size_t bytes) const;
+
+    std::vector<std::int32_t> matriculas_;
+    std::vector<std::uint32_t> offsets_;  // sempre comeca com 0
+    std::vector<char> names_;
+};
+
+//! (1) cria uma turma a partir de nomes e matriculas
+Roster turma(const std::string nomes[], const int matriculas[], int N);
+//! (2) cria uma turma com os alunos de t1 seguidos dos de t2
+Roster turmas_uniao(const Roster& t1, const Roster& t2);
+//! (3) divide 't' em t1 (os k primeiros) e t2 (o restante); t1 ou t2 pode
+//! ser a propria 't', mas nao podem ser a mesma turma
+void turmas_divisao(const Roster& t, std::size_t k, Roster& t1, Roster& t2);
+//! (4) cria uma turma com os alunos de matricula >= menor_matr
+Roster turma_filtra(const Roster& t, int menor_matr);
+//! (4) escreve em 'selection' as posicoes dos alunos de matricula >=
+//! menor_matr; retorna quantas ('selection' precisa de t.size() posicoes)
+std::size_t turma_filtra(const Roster& t, int menor_matr,
+                         std::uint32_t* selection);
+//! (4) substitui o conteudo de 'tf' pelos alunos de matricula >= menor_matr
+void turma_filtra(const Roster& t, int menor_matr, Roster& tf);
+//! (5) conta os alunos por inicial ('A' a 'Z'; outras iniciais sao ignoradas)
+std::array<int, 26> turma_conta(const Roster& t, unsigned threads = 1);
+//! (6) separa os alunos por inicial ('A' a 'Z'), mantendo a ordem
+std::array<Roster, 26> grupos_por_iniciais(const Roster& t);
+
+}  // namespace structures
+
+inline structures::Roster::Roster() {
+    offsets_.push_back(0);
+}
+
+inline void structures::Roster::check_arena(std::size_t bytes) const {
+    if (bytes > UINT32_MAX - names_.size()) {
+        throw std::out_of_range("nomes excedem 4 GiB");
+    }
+}
+
+inline void structures::Roster::reserve(std::size_t students,
+                                        std::size_t name_bytes) {
+    matriculas_.reserve(students);
+    offsets_.reserve(students + 1);
+    names_.reserve(name_bytes);
+}
+
+inline void structures::Roster::push_back(std::string_view nome,
+                                          std::int32_t matricula) {
+    check_arena(nome.size());
+    names_.insert(names_.end(), nome.begin(), nome.end());
+    offsets_.push_back(static_cast<std::uint32_t>(names_.size()));
+    matriculas_.push_back(matricula);
+}
+
+inline void structures::Roster::append(const Roster& other,
+                                       std::size_t begin, std::size_t end) {
+    if (begin > end || end > other.size()) {
+        throw std::out_of_range("intervalo invalido");
+    }
+    if (begin == end) {
+        return;
+    }
+    std::uint32_t first = other.offsets_[begin];
+    std::uint32_t last = other.offsets_[end];
+    check_arena(last - first);
+
+    // 'other' pode ser *this: cresce antes e copia por indices, com os
+    // ponteiros tomados depois do resize (origem e destino nao se sobrepoem)
+    std::size_t old_names = names_.size();
+    std::size_t old_students = matriculas_.size();
+    names_.resize(old_names + (last - first));
+    matriculas_.resize(old_students + (end - begin));
+    offsets_.resize(old_students + 1 + (end - begin));
+    std::copy(other.names_.data() + first, other.names_.data() + last,
+              names_.data() + old_names);
+    std::copy(other.matriculas_.data() + begin,
+              other.matriculas_.data() + end,
+              matriculas_.data() + old_students);
+    // deslocamentos de 'other' passam a contar a partir do fim da arena
+    std::uint32_t shift = static_cast<std::uint32_t>(old_names) - first;
+    for (std::size_t i = 0; i < end - begin; i++) {
+        offsets_[old_students + 1 + i] = other.offsets_[begin + i + 1] + shift;
+    }
+}
+
+inline void structures::Roster::append(const Roster& other) {
+    append(other, 0, other.size());
+}
+
+inline void structures::Roster::append_selected(
+        const Roster& other, const std::uint32_t* selection,
+        std::size_t count) {
+    std::size_t bytes = 0;
+    for (std::size_t j = 0; j < count; j++) {
+        if (selection[j] >= other.size()) {
+            throw std::out_of_range("posicao invalida");
+        }
+        bytes += other.offsets_[selection[j] + 1] -
+                 other.offsets_[selection[j]];
+    }
+    check_arena(bytes);
+
+    // como em append, 'other' pode ser *this: cresce antes e copia por
+    // indices (so posicoes antigas sao lidas)
+    std::size_t at = names_.size();
+    std::size_t old_students = matriculas_.size();
+    names_.resize(at + bytes);
+    matriculas_.resize(old_students + count);
+    offsets_.resize(old_students + 1 + count);
+    for (std::size_t j = 0; j < count; j++) {
+        std::uint32_t i = selection[j];
+        const char* nome = other.names_.data() + other.offsets_[i];
+        std::size_t length = other.offsets_[i + 1] - other.offsets_[i];
+        std::copy(nome, nome + length, names_.data() + at);
+        at += length;
+        offsets_[old_students + 1 + j] = static_cast<std::uint32_t>(at);
+        matriculas_[old_students + j] = other.matriculas_[i];
+    }
+}
+
+inline void structures::Roster::assign(std::vector<std::int32_t>&& matriculas,
+                                       std::vector<std::uint32_t>&& offsets,
+                                       std::vector<char>&& names) {
+    if (names.size() > UINT32_MAX) {
+        throw std::out_of_range("nomes excedem 4 GiB");
+    }
+    if (offsets.size() != matriculas.size() + 1 || offsets[0] != 0 ||
+        offsets.back() != names.size()) {
+        throw std::out_of_range("colunas inconsistentes");
+    }
+    for (std::size_t i = 0; i + 1 < offsets.size(); i++) {
+        if (offsets[i] > offsets[i + 1]) {
+            throw std::out_of_range("colunas inconsistentes");
+        }
+    }
+    matriculas_ = std::move(matriculas);
+    offsets_ = std::move(offsets);
+    names_ = std::move(names);
+}
+
+inline void structures::Roster::clear() {
+    matriculas_.clear();
+    offsets_.resize(1);
+    names_.clear();
+}
+
+inline std::string_view structures::Roster::nome(std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return std::string_view(names_.data() + offsets_[index],
+                            offsets_[index + 1] - offsets_[index]);
+}
+
+inline std::int32_t structures::Roster::matricula(std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return matriculas_[index];
+}
+
+inline const std::int32_t* structures::Roster::matriculas() const {
+    return matriculas_.data();
+}
+
+inline const char* structures::Roster::name_bytes() const {
+    return names_.data();
+}
+
+inline const std::uint32_t* structures::Roster::name_offsets() const {
+    return offsets_.data();
+}
+
+inline std::size_t structures::Roster::name_size() const {
+    return names_.size();
+}
+
+inline std::size_t structures::Roster::size() const {
+    return matriculas_.size();
+}
+
+inline bool structures::Roster::empty() const {
+    return size() == 0;
+}
+
+inline structures::Roster structures::turma(const std::string nomes[],
+                                            const int matriculas[], int N) {
+    std::size_t bytes = 0;
+    for (int i = 0; i < N; i++) {
+        bytes += nomes[i].size();
+    }
+    Roster t;
+    t.reserve(N, bytes);
+    for (int i = 0; i < N; i++) {
+        t.push_back(nomes[i], matriculas[i]);
+    }
+    return t;
+}
+
+inline structures::Roster structures::turmas_uniao(const Roster& t1,
+                                                   const Roster& t2) {
+    Roster tu;
+    tu.reserve(t1.size() + t2.size(), t1.name_size() + t2.name_size());
+    tu.append(t1);
+    tu.append(t2);
+    return tu;
+}
+
+inline void structures::turmas_divisao(const Roster& t, std::size_t k,
+                                       Roster& t1, Roster& t2) {
+    if (k > t.size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    if (&t1 == &t2) {
+        throw std::out_of_range("saidas iguais");
+    }
+    if (&t1 == &t || &t2 == &t) {
+        // limpar a saida apagaria a entrada: monta em locais e troca
+        Roster first, second;
+        first.append(t, 0, k);
+        second.append(t, k, t.size());
+        t1 = std::move(first);
+        t2 = std::move(second);
+        return;
+    }
+    t1.clear();
+    t2.clear();
+    t1.append(t, 0, k);
+    t2.append(t, k, t.size());
+}
+
+inline std::size_t structures::turma_filtra(const Roster& t, int menor_matr,
+                                            std::uint32_t* selection) {
+    return detail::select_at_least(t.matriculas(), t.size(), menor_matr,
+                                   selection);
+}
+
+inline void structures::turma_filtra(const Roster& t, int menor_matr,
+                                     Roster& tf) {
+    if (&tf == &t) {
+        throw std::out_of_range("saida igual a entrada");
+    }
+    std::vector<std::uint32_t> selection(t.size());
+    std::size_t count = turma_filtra(t, menor_matr, selection.data());
+    tf.clear();
+    tf.append_selected(t, selection.data(), count);
+}
+
+inline structures::Roster structures::turma_filtra(const Roster& t,
+                                                   int menor_matr) {
+    Roster tf;
+    turma_filtra(t, menor_matr, tf);
+    return tf;
+}
+
+inline std::array<int, 26> structures::turma_conta(const Roster& t,
+                                                   unsigned threads) {
+    const char* names = t.name_bytes();
+    const std::uint32_t* offsets = t.name_offsets();
+    // histograma do primeiro byte de cada nome (0 para nomes vazios)
+    std::array<std::size_t, 256> bytes = detail::byte_histogram(
+        t.size(), [names, offsets](std::size_t i) {
+            return offsets[i] == offsets[i + 1] ? 0 :
+                static_cast<unsigned char>(names[offsets[i]]);
+        }, threads);
+    std::array<int, 26> c = {};
+    for (int letter = 0; letter < 26; letter++) {
+        c[letter] = static_cast<int>(bytes['A' + letter]);
+    }
+    return c;
+}
+
+inline std::array<structures::Roster, 26> structures::grupos_por_iniciais(
+        const Roster& t) {
+    std::array<int, 26> c = turma_conta(t);
+    std::array<Roster, 26> g;
+    for (int i = 0; i < 26; i++) {
+        g[i].reserve(c[i], 0);
+    }
+    for (std::size_t i = 0; i < t.size(); i++) {
+        std::string_view nome = t.nome(i);
+        unsigned letter = nome.empty() ? 26 :
+            static_cast<unsigned char>(nome[0]) - 'A';
+        if (letter < 26) {
+            g[letter].push_back(nome, t.matricula(i));
+        }
+    }
+    return g;
+}
+
+#endif
@@ -0,0 +1,389 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ROSTER_FILE_H
+#define STRUCTURES_ROSTER_FILE_H
+
+#include <algorithm>  // std::copy
+#include <array>  // std::array
+#include <cstdint>  // std::uint32_t, std::uint64_t
+#include <cstdio>  // std::FILE, std::fwrite
+#include <cstring>  // std::memcmp, std::memcpy
+#include <stdexcept>  // C++ exceptions
+#include <string_view>  // std::string_view
+#include <utility>  // std::move
+#include <vector>  // std::vector
+
+#include "./roster.h"
+#include "./roster_loader.h"
+
+/*
+    Formato em colunas de uma turma, para ser mapeado em memória e
+    consultado direto, sem leitura aluno a aluno:
+
+        cabeçalho (RosterFileHeader, 128 bytes)
+        matrículas      int32[count]
+        deslocamentos   uint32[count + 1]  (nome i: [off[i], off[i + 1]))
+        nomes           char[name_bytes]
+        índice (opcional, flag INITIAL_INDEX):
+            inícios     uint64[27]  (grupo da letra l: [ini[l], ini[l + 1]))
+            alunos      uint32[ini[26]]  (posições, agrupadas por inicial)
+
+    Cada seção começa num múltiplo de 64 bytes (deslocamento no cabeçalho).
+    Os inteiros estão na ordem de bytes de quem gravou; o leitor recusa
+    arquivos de outra ordem pelo campo 'byte_order'. O índice por inicial
+    usa a regra de turma_conta: só nomes que começam com 'A'-'Z'.
+*/
+
+namespace structures {
+
+//! cabecalho do arquivo em colunas
+struct RosterFileHeader {
+    char magic[8];  // "ROSTERC\0"
+    std::uint32_t version;
+    std::uint32_t byte_order;  // 0x01020304 na ordem de quem gravou
+    std::uint64_t flags;
+    std::uint64_t count;
+    std::uint64_t name_bytes;
+    std::uint64_t matriculas_offset;
+    std::uint64_t offsets_offset;
+    std::uint64_t names_offset;
+    std::uint64_t index_offset;  // 0 sem indice
+    std::uint64_t file_size;
+    std::uint64_t reserved[6];
+};
+
+//! grava 't' no formato em colunas (com o indice por inicial, se pedido)
+void save_roster_columns(const Roster& t, const char* path,
+                         bool initial_index = true);
+
+//! CLASSE TURMA MAPEADA
+/*!
+    Abre um arquivo gravado por save_roster_columns e expõe as colunas
+    direto da memória mapeada: abrir custa uma validação do cabeçalho, não
+    uma leitura dos alunos. verify() confere também o conteúdo (O(n)).
+*/
+class MappedRoster {
+ public:
+    //! flag do indice por inicial
+    static constexpr std::uint64_t INITIAL_INDEX = 1;
+    //! versao gravada
+    static constexpr std::uint32_t VERSION = 1;
+
+    //! construtor: mapeia e valida o cabecalho
+    explicit MappedRoster(const char* path);
+    //! metodo confere deslocamentos e indice; lanca se invalidos
+    void verify() const;
+    //! metodo retorna o nome do aluno 'index' (sem copiar)
+    std::string_view nome(std::size_t index) const;
+    //! metodo retorna a matricula do aluno 'index'
+    std::int32_t matricula(std::size_t index) const;
+    //! metodo retorna a coluna de matriculas
+    const std::int32_t* matriculas() const;
+    //! metodo retorna os deslocamentos dos nomes (size() + 1 posicoes)
+    const std::uint32_t* name_offsets() const;
+    //! metodo verifica se o arquivo tem o indice por inicial
+    bool has_initial_index() const;
+    //! metodo retorna as posicoes dos alunos com a inicial 'A' + letter
+    const std::uint32_t* initial_group(int letter, std::size_t& size) const;
+    //! metodo copia para uma Roster
+    Roster to_roster() const;
+    //! metodo retorna a quantidade de alunos
+    std::size_t size() const;
+
+ private:
+    //! ponteiro para 'offset' bytes do inicio do arquivo
+    template<typename T>
+    const T* at(std::uint64_t offset) const {
+        return reinterpret_cast<const T*>(file_.text().data() + offset);
+    }
+
+    detail::MappedFile file_;
+    RosterFileHeader header_;
+    const std::int32_t* matriculas_;
+    const std::uint32_t* offsets_;
+    const char* names_;
+    const std::uint64_t* index_begins_;
+    const std::uint32_t* index_rows_;
+};
+
+//! (4) posicoes dos alunos com matricula >= menor_matr, direto do arquivo
+std::size_t turma_filtra(const MappedRoster& t, int menor_matr,
+                         std::uint32_t* selection);
+//! (5) contagem por inicial (pelo indice, quando houver)
+std::array<int, 26> turma_conta(const MappedRoster& t);
+
+namespace detail {
+
+const char ROSTER_FILE_MAGIC[8] = {'R', 'O', 'S', 'T', 'E', 'R', 'C', '\0'};
+const std::uint32_t ROSTER_FILE_BYTE_ORDER = 0x01020304u;
+
+//! arredonda para o proximo multiplo de 64
+inline std::uint64_t align64(std::uint64_t offset) {
+    return (offset + 63) / 64 * 64;
+}
+
+//! verifica se 'bytes' bytes a partir de 'begin' cabem antes de 'end'
+//! (por subtracao: somas de campos do arquivo poderiam dar a volta)
+inline bool section_fits(std::uint64_t begin, std::uint64_t bytes,
+                         std::uint64_t end) {
+    return begin <= end && end - begin >= bytes;
+}
+
+}  // namespace detail
+
+}  // namespace structures
+
+inline void structures::save_roster_columns(const Roster& t, const char* path,
+                                            bool initial_index) {
+    std::uint64_t count = t.size();
+    RosterFileHeader header = {};
+    std::memcpy(header.magic, detail::ROSTER_FILE_MAGIC, 8);
+    header.version = MappedRoster::VERSION;
+    header.byte_order = detail::ROSTER_FILE_BYTE_ORDER;
+    header.flags = initial_index ? MappedRoster::INITIAL_INDEX : 0;
+    header.count = count;
+    header.name_bytes = t.name_size();
+    header.matriculas_offset = detail::align64(sizeof(RosterFileHeader));
+    header.offsets_offset = detail::align64(header.matriculas_offset +
+                                            count * sizeof(std::int32_t));
+    header.names_offset = detail::align64(header.offsets_offset +
+                                          (count + 1) * sizeof(std::uint32_t));
+    std::uint64_t end = header.names_offset + header.name_bytes;
+
+    // indice: as posicoes agrupadas por inicial, como grupos_por_iniciais
+    std::array<std::uint64_t, 27> begins = {};
+    std::vector<std::uint32_t> rows;
+    if (initial_index) {
+        std::array<int, 26> c = turma_conta(t);
+        for (int l = 0; l < 26; l++) {
+            begins[l + 1] = begins[l] + c[l];
+        }
+        rows.resize(begins[26]);
+        std::array<std::uint64_t, 26> next;
+        std::copy(begins.begin(), begins.begin() + 26, next.begin());
+        for (std::size_t i = 0; i < t.size(); i++) {
+            std::string_view nome = t.nome(i);
+            unsigned letter = nome.empty() ? 26 :
+                static_cast<unsigned char>(nome[0]) - 'A';
+            if (letter < 26) {
+                rows[next[letter]++] = static_cast<std::uint32_t>(i);
+            }
+        }
+        header.index_offset = detail::align64(end);
+        end = header.index_offset + sizeof(begins) +
+              rows.size() * sizeof(std::uint32_t);
+    }
+    header.file_size = end;
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("arquivo nao pode ser criado");
+    }
+    std::uint64_t written = 0;
+    bool ok = true;
+    auto write = [&](std::uint64_t offset, const void* data,
+                     std::uint64_t size) {
+        static const char zeros[64] = {};
+        while (ok && written < offset) {  // preenche ate o alinhamento
+            std::uint64_t pad = offset - written < 64 ? offset - written : 64;
+            ok = std::fwrite(zeros, 1, pad, file) == pad;
+            written += pad;
+        }
+        if (ok && size > 0) {
+            ok = std::fwrite(data, 1, size, file) == size;
+            written += size;
+        }
+    };
+    write(0, &header, sizeof(header));
+    write(header.matriculas_offset, t.matriculas(),
+          count * sizeof(std::int32_t));
+    write(header.offsets_offset, t.name_offsets(),
+          (count + 1) * sizeof(std::uint32_t));
+    write(header.names_offset, t.name_bytes(), header.name_bytes);
+    if (initial_index) {
+        write(header.index_offset, begins.data(), sizeof(begins));
+        write(header.index_offset + sizeof(begins), rows.data(),
+              rows.size() * sizeof(std::uint32_t));
+    }
+    if (std::fclose(file) != 0 || !ok) {
+        throw std::runtime_error("arquivo nao pode ser gravado");
+    }
+}
+
+inline structures::MappedRoster::MappedRoster(const char* path):
+    file_(path, detail::FileAccess::NORMAL)  // varreduras e acesso por posicao
+{
+    std::string_view text = file_.text();
+    if (text.size() < sizeof(RosterFileHeader)) {
+        throw std::runtime_error("arquivo de turma invalido");
+    }
+    std::memcpy(&header_, text.data(), sizeof(header_));
+    if (std::memcmp(header_.magic, detail::ROSTER_FILE_MAGIC, 8) != 0 ||
+        header_.version != VERSION) {
+        throw std::runtime_error("arquivo de turma invalido");
+    }
+    if (header_.byte_order != detail::ROSTER_FILE_BYTE_ORDER) {
+        throw std::runtime_error("arquivo de turma com outra ordem de bytes");
+    }
+
+    // cada secao dentro do arquivo, alinhada e na ordem do formato
+    std::uint64_t n = header_.count;
+    bool indexed = (header_.flags & INITIAL_INDEX) != 0;
+    bool ok = header_.file_size == text.size() &&
+              n < UINT32_MAX && header_.name_bytes <= UINT32_MAX &&
+              header_.matriculas_offset % 64 == 0 &&
+              header_.offsets_offset % 64 == 0 &&
+              header_.index_offset % 64 == 0 &&
+              header_.matriculas_offset >= sizeof(RosterFileHeader) &&
+              detail::section_fits(header_.matriculas_offset, 4 * n,
+                                   header_.offsets_offset) &&
+              detail::section_fits(header_.offsets_offset, 4 * (n + 1),
+                                   header_.names_offset) &&
+              detail::section_fits(header_.names_offset, header_.name_bytes,
+                                   text.size());
+    if (ok && indexed) {
+        ok = detail::section_fits(header_.names_offset, header_.name_bytes,
+                                  header_.index_offset) &&
+             detail::section_fits(header_.index_offset, 27 * 8, text.size());
+    }
+    if (!ok) {
+        throw std::runtime_error("arquivo de turma invalido");
+    }
+
+    matriculas_ = at<std::int32_t>(header_.matriculas_offset);
+    offsets_ = at<std::uint32_t>(header_.offsets_offset);
+    names_ = at<char>(header_.names_offset);
+    index_begins_ = nullptr;
+    index_rows_ = nullptr;
+    if (indexed) {
+        index_begins_ = at<std::uint64_t>(header_.index_offset);
+        index_rows_ = at<std::uint32_t>(header_.index_offset + 27 * 8);
+        std::uint64_t rows = index_begins_[26];
+        if (rows > n || !detail::section_fits(header_.index_offset + 27 * 8,
+                                              4 * rows, text.size())) {
+            throw std::runtime_error("arquivo de turma invalido");
+        }
+    }
+    if (offsets_[0] != 0 || offsets_[n] != header_.name_bytes) {
+        throw std::runtime_error("arquivo de turma invalido");
+    }
+}
+
+inline void structures::MappedRoster::verify() const {
+    for (std::size_t i = 0; i < size(); i++) {
+        if (offsets_[i] > offsets_[i + 1]) {
+            throw std::runtime_error("arquivo de turma invalido");
+        }
+    }
+    if (!has_initial_index()) {
+        return;
+    }
+    std::array<int, 26> c = {};
+    for (std::size_t i = 0; i < size(); i++) {
+        std::string_view nome = this->nome(i);
+        unsigned letter = nome.empty() ? 26 :
+            static_cast<unsigned char>(nome[0]) - 'A';
+        if (letter < 26) {
+            c[letter]++;
+        }
+    }
+    for (int l = 0; l < 26; l++) {
+        if (index_begins_[l] > index_begins_[l + 1] ||
+            index_begins_[l + 1] - index_begins_[l] !=
+                static_cast<std::uint64_t>(c[l])) {
+            throw std::runtime_error("indice de turma invalido");
+        }
+        for (std::uint64_t j = index_begins_[l]; j < index_begins_[l + 1];
+             j++) {
+            std::uint32_t row = index_rows_[j];
+            if (row >= size() || offsets_[row] == offsets_[row + 1] ||
+                names_[offsets_[row]] != 'A' + l ||
+                (j > index_begins_[l] && row <= index_rows_[j - 1])) {
+                throw std::runtime_error("indice de turma invalido");
+            }
+        }
+    }
+}
+
+inline std::string_view structures::MappedRoster::nome(
+        std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return std::string_view(names_ + offsets_[index],
+                            offsets_[index + 1] - offsets_[index]);
+}
+
+inline std::int32_t structures::MappedRoster::matricula(
+        std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return matriculas_[index];
+}
+
+inline const std::int32_t* structures::MappedRoster::matriculas() const {
+    return matriculas_;
+}
+
+inline const std::uint32_t* structures::MappedRoster::name_offsets() const {
+    return offsets_;
+}
+
+inline bool structures::MappedRoster::has_initial_index() const {
+    return index_begins_ != nullptr;
+}
+
+inline const std::uint32_t* structures::MappedRoster::initial_group(
+        int letter, std::size_t& size) const {
+    if (letter < 0 || letter >= 26) {
+        throw std::out_of_range("inicial invalida");
+    }
+    if (!has_initial_index()) {
+        throw std::out_of_range("arquivo sem indice por inicial");
+    }
+    size = index_begins_[letter + 1] - index_begins_[letter];
+    return index_rows_ + index_begins_[letter];
+}
+
+inline structures::Roster structures::MappedRoster::to_roster() const {
+    std::vector<std::int32_t> matriculas(matriculas_, matriculas_ + size());
+    std::vector<std::uint32_t> offsets(offsets_, offsets_ + size() + 1);
+    std::vector<char> names(names_, names_ + header_.name_bytes);
+    Roster t;
+    t.assign(std::move(matriculas), std::move(offsets), std::move(names));
+    return t;
+}
+
+inline std::size_t structures::MappedRoster::size() const {
+    return static_cast<std::size_t>(header_.count);
+}
+
+inline std::size_t structures::turma_filtra(const MappedRoster& t,
+                                            int menor_matr,
+                                            std::uint32_t* selection) {
+    return detail::select_at_least(t.matriculas(), t.size(), menor_matr,
+                                   selection);
+}
+
+inline std::array<int, 26> structures::turma_conta(const MappedRoster& t) {
+    std::array<int, 26> c = {};
+    if (t.has_initial_index()) {
+        for (int l = 0; l < 26; l++) {
+            std::size_t size;
+            t.initial_group(l, size);
+            c[l] = static_cast<int>(size);
+        }
+        return c;
+    }
+    for (std::size_t i = 0; i < t.size(); i++) {
+        std::string_view nome = t.nome(i);
+        unsigned letter = nome.empty() ? 26 :
+            static_cast<unsigned char>(nome[0]) - 'A';
+        if (letter < 26) {
+            c[letter]++;
+        }
+    }
+    return c;
+}
+
+#endif
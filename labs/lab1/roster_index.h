@@ -0,0 +1,308 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ROSTER_INDEX_H
+#define STRUCTURES_ROSTER_INDEX_H
+
+#include <cstdint>  // std::int32_t, std::uint32_t, std::uint64_t
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::swap
+#include <vector>  // std::vector
+
+#include "./roster.h"
+
+namespace structures {
+
+//! CLASSE INDICE POR MATRICULA
+/*!
+    Tabela hash de endereçamento aberto (Robin Hood) de matrícula para
+    posição na turma. Cada entrada guarda a própria distância à posição
+    inicial; na inserção, quem está mais longe de casa toma o lugar de quem
+    está mais perto, então as sequências de sondagem ficam curtas e a busca
+    de uma matrícula ausente para assim que encontra uma entrada mais perto
+    de casa do que ela estaria. A remoção puxa as entradas seguintes uma
+    posição para trás, sem marcas de apagado.
+
+    As buscas em lote calculam a posição inicial das chaves algumas
+    iterações antes e pedem a linha de cache ao processador, escondendo a
+    latência de memória quando a tabela não cabe na cache.
+*/
+class RosterIndex {
+ public:
+    //! posicao devolvida para matriculas ausentes
+    static constexpr std::uint32_t NOT_FOUND = 0xFFFFFFFF;
+
+    //! construtor vazio
+    RosterIndex();
+    //! construtor do indice da turma inteira
+    explicit RosterIndex(const Roster& t);
+    //! construtor do indice de matriculas[0, n)
+    RosterIndex(const std::int32_t* matriculas, std::size_t n);
+    //! metodo refaz o indice: matriculas[i] -> i (repetidas: vale a primeira)
+    void build(const std::int32_t* matriculas, std::size_t n);
+    //! metodo garante espaco para 'n' matriculas sem crescer
+    void reserve(std::size_t n);
+    //! metodo associa 'matricula' a 'position'; falso se ja existia
+    bool insert(std::int32_t matricula, std::uint32_t position);
+    //! metodo remove 'matricula'; falso se nao existia
+    bool erase(std::int32_t matricula);
+    //! metodo retorna a posicao de 'matricula' (ou NOT_FOUND)
+    std::uint32_t find(std::int32_t matricula) const;
+    //! metodo busca keys[0, n) e escreve as posicoes em 'out'
+    void find(const std::int32_t* keys, std::size_t n,
+              std::uint32_t* out) const;
+    //! metodo verifica se 'matricula' esta no indice
+    bool contains(std::int32_t matricula) const;
+    //! metodo esvazia o indice
+    void clear();
+    //! metodo retorna a quantidade de matriculas
+    std::size_t size() const;
+    //! metodo verifica se esta vazio
+    bool empty() const;
+    //! metodo retorna a quantidade de entradas da tabela
+    std::size_t capacity() const;
+
+ private:
+    struct Slot {
+        std::int32_t key;
+        std::uint32_t position;
+        std::uint32_t distance;  // 0: vazia; senao sondagens ate aqui + 1
+    };
+
+    //! posicao inicial de 'key' na tabela
+    std::size_t home(std::int32_t key) const;
+    //! busca a partir da posicao inicial ja calculada
+    std::uint32_t find_from(std::size_t slot, std::int32_t key) const;
+    //! insercao sem verificar a ocupacao
+    bool insert_from(std::size_t slot, std::int32_t key,
+                     std::uint32_t position);
+    //! troca a tabela por uma de 'capacity' entradas e reinsere tudo
+    void rehash(std::size_t capacity);
+
+    static constexpr std::size_t MIN_CAPACITY = 16;
+    static constexpr std::size_t PREFETCH_DISTANCE = 16;
+
+    std::vector<Slot> slots_;
+    std::size_t mask_;
+    unsigned shift_;
+    std::size_t size_;
+};
+
+namespace detail {
+
+//! pede ao processador a linha de cache de 'p' (so uma dica)
+inline void prefetch(const void* p) {
+#if defined(__GNUC__)
+    __builtin_prefetch(p);
+#else
+    (void) p;
+#endif
+}
+
+}  // namespace detail
+
+}  // namespace structures
+
+inline structures::RosterIndex::RosterIndex() {
+    mask_ = 0;
+    shift_ = 64;
+    size_ = 0;
+}
+
+inline structures::RosterIndex::RosterIndex(const Roster& t):
+    RosterIndex(t.matriculas(), t.size())
+{}
+
+inline structures::RosterIndex::RosterIndex(const std::int32_t* matriculas,
+                                            std::size_t n):
+    RosterIndex()
+{
+    build(matriculas, n);
+}
+
+inline void structures::RosterIndex::build(const std::int32_t* matriculas,
+                                           std::size_t n) {
+    if (n >= NOT_FOUND) {
+        throw std::out_of_range("turma grande demais para o indice");
+    }
+    clear();
+    reserve(n);
+    std::size_t homes[PREFETCH_DISTANCE];
+    for (std::size_t i = 0; i < n && i < PREFETCH_DISTANCE; i++) {
+        homes[i] = home(matriculas[i]);
+        detail::prefetch(&slots_[homes[i]]);
+    }
+    for (std::size_t i = 0; i < n; i++) {
+        std::size_t slot = homes[i % PREFETCH_DISTANCE];
+        if (i + PREFETCH_DISTANCE < n) {
+            std::size_t ahead = home(matriculas[i + PREFETCH_DISTANCE]);
+            detail::prefetch(&slots_[ahead]);
+            homes[i % PREFETCH_DISTANCE] = ahead;
+        }
+        insert_from(slot, matriculas[i], static_cast<std::uint32_t>(i));
+    }
+}
+
+inline void structures::RosterIndex::reserve(std::size_t n) {
+    std::size_t capacity = MIN_CAPACITY;
+    while (capacity - capacity / 8 < n) {  // ocupacao maxima de 7/8
+        capacity *= 2;
+    }
+    if (capacity > slots_.size()) {
+        rehash(capacity);
+    }
+}
+
+inline bool structures::RosterIndex::insert(std::int32_t matricula,
+                                            std::uint32_t position) {
+    if (position == NOT_FOUND) {
+        throw std::out_of_range("posicao invalida");
+    }
+    if (slots_.size() - slots_.size() / 8 <= size_) {
+        reserve(size_ + 1);
+    }
+    return insert_from(home(matricula), matricula, position);
+}
+
+inline bool structures::RosterIndex::erase(std::int32_t matricula) {
+    if (empty()) {
+        return false;
+    }
+    std::size_t slot = home(matricula);
+    for (std::uint32_t distance = 1;; distance++) {
+        const Slot& s = slots_[slot];
+        if (s.distance < distance) {
+            return false;
+        }
+        if (s.key == matricula) {
+            break;
+        }
+        slot = (slot + 1) & mask_;
+    }
+    // puxa para tras as entradas que nao estao em casa
+    std::size_t next = (slot + 1) & mask_;
+    while (slots_[next].distance > 1) {
+        slots_[slot] = slots_[next];
+        slots_[slot].distance--;
+        slot = next;
+        next = (next + 1) & mask_;
+    }
+    slots_[slot].distance = 0;
+    size_--;
+    return true;
+}
+
+inline std::uint32_t structures::RosterIndex::find(
+        std::int32_t matricula) const {
+    if (empty()) {
+        return NOT_FOUND;
+    }
+    return find_from(home(matricula), matricula);
+}
+
+inline void structures::RosterIndex::find(const std::int32_t* keys,
+                                          std::size_t n,
+                                          std::uint32_t* out) const {
+    if (empty()) {
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = NOT_FOUND;
+        }
+        return;
+    }
+    std::size_t homes[PREFETCH_DISTANCE];
+    for (std::size_t i = 0; i < n && i < PREFETCH_DISTANCE; i++) {
+        homes[i] = home(keys[i]);
+        detail::prefetch(&slots_[homes[i]]);
+    }
+    for (std::size_t i = 0; i < n; i++) {
+        std::size_t slot = homes[i % PREFETCH_DISTANCE];
+        if (i + PREFETCH_DISTANCE < n) {
+            std::size_t ahead = home(keys[i + PREFETCH_DISTANCE]);
+            detail::prefetch(&slots_[ahead]);
+            homes[i % PREFETCH_DISTANCE] = ahead;
+        }
+        out[i] = find_from(slot, keys[i]);
+    }
+}
+
+inline bool structures::RosterIndex::contains(std::int32_t matricula) const {
+    return find(matricula) != NOT_FOUND;
+}
+
+inline void structures::RosterIndex::clear() {
+    for (Slot& s : slots_) {
+        s.distance = 0;
+    }
+    size_ = 0;
+}
+
+inline std::size_t structures::RosterIndex::size() const {
+    return size_;
+}
+
+inline bool structures::RosterIndex::empty() const {
+    return size() == 0;
+}
+
+inline std::size_t structures::RosterIndex::capacity() const {
+    return slots_.size();
+}
+
+inline std::size_t structures::RosterIndex::home(std::int32_t key) const {
+    // hash de Fibonacci: os bits altos do produto espalham chaves seguidas
+    std::uint64_t h = static_cast<std::uint64_t>(
+        static_cast<std::uint32_t>(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(h >> shift_);
+}
+
+inline std::uint32_t structures::RosterIndex::find_from(
+        std::size_t slot, std::int32_t key) const {
+    for (std::uint32_t distance = 1;; distance++) {
+        const Slot& s = slots_[slot];
+        if (s.distance < distance) {  // vazia ou mais perto de casa
+            return NOT_FOUND;
+        }
+        if (s.key == key) {
+            return s.position;
+        }
+        slot = (slot + 1) & mask_;
+    }
+}
+
+inline bool structures::RosterIndex::insert_from(std::size_t slot,
+                                                 std::int32_t key,
+                                                 std::uint32_t position) {
+    Slot carried = {key, position, 1};
+    bool displaced = false;
+    for (;; slot = (slot + 1) & mask_, carried.distance++) {
+        Slot& s = slots_[slot];
+        if (s.distance == 0) {
+            s = carried;
+            size_++;
+            return true;
+        }
+        if (!displaced && s.key == key) {
+            return false;
+        }
+        if (s.distance < carried.distance) {
+            std::swap(s, carried);
+            displaced = true;
+        }
+    }
+}
+
+inline void structures::RosterIndex::rehash(std::size_t capacity) {
+    std::vector<Slot> old(capacity, Slot{0, 0, 0});
+    old.swap(slots_);
+    mask_ = capacity - 1;
+    shift_ = 64;
+    for (std::size_t c = capacity; c > 1; c /= 2) {
+        shift_--;
+    }
+    size_ = 0;
+    for (const Slot& s : old) {
+        if (s.distance != 0) {
+            insert_from(home(s.key), s.key, s.position);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,453 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ROSTER_LOADER_H
+#define STRUCTURES_ROSTER_LOADER_H
+
+#include <algorithm>  // std::max
+#include <chrono>  // std::chrono
+#include <cstdint>  // std::int64_t, std::uint64_t
+#include <cstdio>  // std::FILE, std::fwrite
+#include <cstring>  // std::memchr, std::memcpy
+#include <exception>  // std::exception_ptr
+#include <stdexcept>  // C++ exceptions
+#include <string>  // std::string, std::to_string
+#include <string_view>  // std::string_view
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>  // open
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <sys/resource.h>  // getrusage
+#include <sys/stat.h>  // fstat
+#include <unistd.h>  // close
+#else
+#include <fstream>  // std::ifstream
+#include <iterator>  // std::istreambuf_iterator
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "./buckets.h"
+#include "./roster.h"
+
+/*
+    Leitura de turmas em CSV: uma linha "nome,matricula" por aluno (o nome
+    vai até a última vírgula, então pode conter vírgulas; "\r\n" também é
+    aceito e linhas vazias são ignoradas).
+
+    O arquivo é mapeado em memória e dividido em um trecho por thread, com
+    as fronteiras ajustadas para inícios de linha. Cada thread acha vírgulas
+    e quebras de linha 64 bytes por vez (comparação SIMD e máscara de bits)
+    e escreve nomes numa arena própria, sem nenhuma alocação por aluno; no
+    fim, as colunas de cada trecho são copiadas em paralelo para a turma.
+*/
+
+namespace structures {
+
+//! medidas de uma leitura
+struct LoadStats {
+    std::uint64_t bytes = 0;
+    std::size_t rows = 0;
+    double seconds = 0.0;
+    std::size_t peak_rss = 0;  // pico de memoria residente do processo
+
+    //! vazao da leitura
+    double gigabytes_per_second() const {
+        return seconds > 0 ? bytes / seconds / 1e9 : 0.0;
+    }
+};
+
+//! le uma turma de um texto CSV
+Roster parse_roster_csv(std::string_view text, unsigned threads = 0,
+                        bool header = false);
+//! le uma turma de um arquivo CSV mapeado em memoria
+Roster load_roster_csv(const char* path, unsigned threads = 0,
+                       bool header = false, LoadStats* stats = nullptr);
+//! grava uma turma em CSV
+void save_roster_csv(const Roster& t, const char* path);
+//! pico de memoria residente do processo, em bytes (0 se indisponivel)
+std::size_t peak_rss_bytes();
+
+namespace detail {
+
+//! virgulas e quebras de linha de um bloco de 64 bytes (bit i = byte i)
+struct CsvMasks {
+    std::uint64_t comma;
+    std::uint64_t newline;
+};
+
+#if defined(__AVX2__)
+inline CsvMasks csv_classify(const char* block) {
+    CsvMasks masks = {0, 0};
+    for (int half = 0; half < 2; half++) {
+        __m256i v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(block + 32 * half));
+        std::uint64_t comma = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(v, _mm256_set1_epi8(','))));
+        std::uint64_t newline = static_cast<std::uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                v, _mm256_set1_epi8('\n'))));
+        masks.comma |= comma << (32 * half);
+        masks.newline |= newline << (32 * half);
+    }
+    return masks;
+}
+#elif defined(__SSE2__)
+inline CsvMasks csv_classify(const char* block) {
+    CsvMasks masks = {0, 0};
+    for (int quarter = 0; quarter < 4; quarter++) {
+        __m128i v = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(block + 16 * quarter));
+        std::uint64_t comma = static_cast<std::uint16_t>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(v, _mm_set1_epi8(','))));
+        std::uint64_t newline = static_cast<std::uint16_t>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+        masks.comma |= comma << (16 * quarter);
+        masks.newline |= newline << (16 * quarter);
+    }
+    return masks;
+}
+#else
+inline CsvMasks csv_classify(const char* block) {
+    CsvMasks masks = {0, 0};
+    for (int i = 0; i < 64; i++) {
+        std::uint64_t bit = static_cast<std::uint64_t>(1) << i;
+        masks.comma |= block[i] == ',' ? bit : 0;
+        masks.newline |= block[i] == '\n' ? bit : 0;
+    }
+    return masks;
+}
+#endif
+
+//! colunas lidas de um trecho
+struct CsvChunk {
+    std::vector<std::int32_t> matriculas;
+    std::vector<std::uint32_t> ends;  // fim de cada nome na arena do trecho
+    std::vector<char> names;
+};
+
+//! erro de leitura na posicao 'pos' do texto
+inline std::runtime_error csv_error(std::size_t pos) {
+    return std::runtime_error("linha invalida no byte " +
+                              std::to_string(pos));
+}
+
+//! le a linha text[begin, end) com a ultima virgula em 'comma'
+inline void csv_row(const char* text, std::size_t begin, std::size_t end,
+                    std::size_t comma, CsvChunk& chunk) {
+    if (end > begin && text[end - 1] == '\r') {
+        end--;
+    }
+    if (end == begin) {
+        return;  // linha vazia
+    }
+    if (comma < begin || comma >= end) {
+        throw csv_error(begin);
+    }
+
+    std::size_t i = comma + 1;
+    while (i < end && text[i] == ' ') {
+        i++;
+    }
+    bool negative = i < end && text[i] == '-';
+    if (i < end && (text[i] == '-' || text[i] == '+')) {
+        i++;
+    }
+    std::int64_t value = 0;
+    std::size_t digits = 0;
+    for (; i < end && text[i] >= '0' && text[i] <= '9'; i++, digits++) {
+        value = value * 10 + (text[i] - '0');
+        if (value > INT32_MAX + std::int64_t(1)) {
+            throw csv_error(begin);
+        }
+    }
+    while (i < end && text[i] == ' ') {
+        i++;
+    }
+    value = negative ? -value : value;
+    if (digits == 0 || i != end || value > INT32_MAX || value < INT32_MIN) {
+        throw csv_error(begin);
+    }
+
+    chunk.names.insert(chunk.names.end(), text + begin, text + comma);
+    chunk.ends.push_back(static_cast<std::uint32_t>(chunk.names.size()));
+    chunk.matriculas.push_back(static_cast<std::int32_t>(value));
+}
+
+//! le as linhas que comecam em text[begin, end)
+inline void csv_parse(const char* text, std::size_t begin, std::size_t end,
+                      CsvChunk& chunk) {
+    chunk.names.reserve(end - begin);  // limite superior: sem realocar
+    chunk.ends.reserve((end - begin) / 16);
+    chunk.matriculas.reserve((end - begin) / 16);
+
+    std::size_t line = begin;
+    std::size_t comma = begin - 1;  // ultima virgula vista (nenhuma)
+    for (std::size_t block = begin; block < end; block += 64) {
+        CsvMasks masks;
+        if (end - block >= 64) {
+            masks = csv_classify(text + block);
+        } else {
+            char padded[64] = {};
+            std::memcpy(padded, text + block, end - block);
+            masks = csv_classify(padded);
+        }
+
+        std::uint64_t newlines = masks.newline;
+        while (newlines != 0) {
+            int i = __builtin_ctzll(newlines);
+            std::uint64_t before = masks.comma &
+                ((static_cast<std::uint64_t>(1) << i) - 1);
+            if (before != 0) {
+                comma = block + 63 - __builtin_clzll(before);
+            }
+            csv_row(text, line, block + i, comma, chunk);
+            line = block + i + 1;
+            // virgulas ja consumidas nao valem para a proxima linha
+            masks.comma &= ~((static_cast<std::uint64_t>(2) << i) - 1);
+            newlines &= newlines - 1;
+        }
+        if (masks.comma != 0) {
+            comma = block + 63 - __builtin_clzll(masks.comma);
+        }
+    }
+    if (line < end) {  // ultima linha sem quebra
+        csv_row(text, line, end, comma, chunk);
+    }
+}
+
+//! padrao de acesso esperado a um arquivo mapeado (conselho ao sistema)
+enum class FileAccess {
+    SEQUENTIAL,  // leitura do inicio ao fim: leitura antecipada agressiva
+    RANDOM,  // posicoes esparsas: sem leitura antecipada
+    NORMAL  // padrao do sistema
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+//! arquivo mapeado em memoria (somente leitura)
+class MappedFile {
+ public:
+    explicit MappedFile(const char* path,
+                        FileAccess access = FileAccess::SEQUENTIAL) {
+        data_ = nullptr;
+        size_ = 0;
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("arquivo nao pode ser aberto");
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("arquivo nao pode ser lido");
+        }
+        size_ = static_cast<std::size_t>(info.st_size);
+        if (size_ > 0) {
+            void* map = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("arquivo nao pode ser mapeado");
+            }
+            ::madvise(map, size_, access == FileAccess::SEQUENTIAL ?
+                                  MADV_SEQUENTIAL :
+                                  access == FileAccess::RANDOM ?
+                                  MADV_RANDOM : MADV_NORMAL);
+            data_ = static_cast<const char*>(map);
+        }
+        ::close(fd);
+    }
+    ~MappedFile() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view text() const {
+        return std::string_view(data_, size_);
+    }
+
+ private:
+    const char* data_;
+    std::size_t size_;
+};
+#else
+//! arquivo lido inteiro (sem mmap nesta plataforma; 'access' e ignorado)
+class MappedFile {
+ public:
+    explicit MappedFile(const char* path,
+                        FileAccess access = FileAccess::SEQUENTIAL) {
+        static_cast<void>(access);
+        std::ifstream input(path, std::ios::binary);
+        if (!input) {
+            throw std::runtime_error("arquivo nao pode ser aberto");
+        }
+        contents_.assign(std::istreambuf_iterator<char>(input),
+                         std::istreambuf_iterator<char>());
+    }
+
+    std::string_view text() const {
+        return contents_;
+    }
+
+ private:
+    std::string contents_;
+};
+#endif
+
+}  // namespace detail
+
+}  // namespace structures
+
+inline structures::Roster structures::parse_roster_csv(std::string_view text,
+                                                       unsigned threads,
+                                                       bool header) {
+    const char* data = text.data();
+    std::size_t size = text.size();
+    std::size_t first = 0;
+    if (header && size > 0) {
+        const void* nl = std::memchr(data, '\n', size);
+        first = nl == nullptr ? size :
+            static_cast<const char*>(nl) - data + 1;
+    }
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (size - first < BUCKET_PARALLEL_MIN_SIZE) {
+        threads = 1;
+    }
+
+    // trecho t: linhas que comecam em [bounds[t], bounds[t + 1])
+    std::vector<std::size_t> bounds(threads + 1, size);
+    bounds[0] = first;
+    for (unsigned t = 1; t < threads; t++) {
+        std::size_t nominal = first + (size - first) / threads * t;
+        nominal = std::max(nominal, bounds[t - 1]);
+        const void* nl = std::memchr(data + nominal, '\n', size - nominal);
+        bounds[t] = nl == nullptr ? size :
+            static_cast<const char*>(nl) - data + 1;
+    }
+
+    std::vector<detail::CsvChunk> chunks(threads);
+    std::vector<std::exception_ptr> errors(threads);
+    detail::run_threads(threads, [&](unsigned t) {
+        try {
+            detail::csv_parse(data, bounds[t], bounds[t + 1], chunks[t]);
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    });
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);  // o primeiro no texto
+        }
+    }
+
+    // posicao de cada trecho nas colunas finais
+    std::vector<std::size_t> rows(threads + 1, 0);
+    std::vector<std::size_t> bytes(threads + 1, 0);
+    for (unsigned t = 0; t < threads; t++) {
+        rows[t + 1] = rows[t] + chunks[t].matriculas.size();
+        bytes[t + 1] = bytes[t] + chunks[t].names.size();
+    }
+    if (bytes[threads] > UINT32_MAX) {
+        throw std::out_of_range("nomes excedem 4 GiB");
+    }
+
+    std::vector<std::int32_t> matriculas(rows[threads]);
+    std::vector<std::uint32_t> offsets(rows[threads] + 1);
+    std::vector<char> names(bytes[threads]);
+    offsets[0] = 0;
+    detail::run_threads(threads, [&](unsigned t) {
+        detail::CsvChunk& chunk = chunks[t];
+        std::size_t n = chunk.matriculas.size();
+        if (n > 0) {
+            std::memcpy(matriculas.data() + rows[t], chunk.matriculas.data(),
+                        n * sizeof(std::int32_t));
+        }
+        if (!chunk.names.empty()) {
+            std::memcpy(names.data() + bytes[t], chunk.names.data(),
+                        chunk.names.size());
+        }
+        std::uint32_t shift = static_cast<std::uint32_t>(bytes[t]);
+        for (std::size_t i = 0; i < n; i++) {
+            offsets[rows[t] + i + 1] = chunk.ends[i] + shift;
+        }
+    });
+
+    Roster t;
+    t.assign(std::move(matriculas), std::move(offsets), std::move(names));
+    return t;
+}
+
+inline structures::Roster structures::load_roster_csv(const char* path,
+                                                      unsigned threads,
+                                                      bool header,
+                                                      LoadStats* stats) {
+    auto start = std::chrono::steady_clock::now();
+    detail::MappedFile file(path);
+    Roster t = parse_roster_csv(file.text(), threads, header);
+    if (stats != nullptr) {
+        stats->bytes = file.text().size();
+        stats->rows = t.size();
+        stats->seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        stats->peak_rss = peak_rss_bytes();
+    }
+    return t;
+}
+
+inline void structures::save_roster_csv(const Roster& t, const char* path) {
+    for (std::size_t i = 0; i < t.size(); i++) {
+        std::string_view nome = t.nome(i);
+        if (nome.find('\n') != std::string_view::npos) {
+            throw std::out_of_range("nome com quebra de linha");
+        }
+    }
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("arquivo nao pode ser criado");
+    }
+    std::vector<char> buffer;
+    buffer.reserve(1 << 16);
+    bool ok = true;
+    for (std::size_t i = 0; i < t.size() && ok; i++) {
+        std::string_view nome = t.nome(i);
+        std::string matricula = std::to_string(t.matricula(i));
+        buffer.insert(buffer.end(), nome.begin(), nome.end());
+        buffer.push_back(',');
+        buffer.insert(buffer.end(), matricula.begin(), matricula.end());
+        buffer.push_back('\n');
+        if (buffer.size() >= (1 << 16) - 64 || i + 1 == t.size()) {
+            ok = std::fwrite(buffer.data(), 1, buffer.size(), file) ==
+                 buffer.size();
+            buffer.clear();
+        }
+    }
+    if (std::fclose(file) != 0 || !ok) {
+        throw std::runtime_error("arquivo nao pode ser gravado");
+    }
+}
+
+inline std::size_t structures::peak_rss_bytes() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<std::size_t>(usage.ru_maxrss);  // em bytes
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;  // em KiB
+#endif
+#else
+    return 0;
+#endif
+}
+
+#endif
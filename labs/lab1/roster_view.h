@@ -0,0 +1,294 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ROSTER_VIEW_H
+#define STRUCTURES_ROSTER_VIEW_H
+
+#include <algorithm>  // std::upper_bound
+#include <cstdint>  // std::int32_t
+#include <stdexcept>  // C++ exceptions
+#include <string_view>  // std::string_view
+#include <vector>  // std::vector
+
+#include "./roster.h"
+
+namespace structures {
+
+//! CLASSE VISTA DE TURMA
+/*!
+    Faixa [begin, end) de uma Roster, sem cópia: dividir uma vista é O(1).
+    A vista não possui os alunos; a Roster precisa continuar viva e sem
+    alterações enquanto houver vistas sobre ela. Por isso não há vista de
+    uma Roster temporária: RosterView v = turma(...) não compila.
+*/
+class RosterView {
+ public:
+    //! construtor vazio
+    RosterView();
+    //! construtor da turma inteira
+    RosterView(const Roster& roster);  // NOLINT(runtime/explicit)
+    //! construtor de uma faixa
+    RosterView(const Roster& roster, std::size_t begin, std::size_t end);
+    //! vistas de temporarios ficariam soltas: recusadas na compilacao
+    RosterView(const Roster&& roster) = delete;
+    RosterView(const Roster&& roster, std::size_t begin,
+               std::size_t end) = delete;
+    //! metodo retorna a vista dos 'count' alunos a partir de 'begin'
+    RosterView subview(std::size_t begin, std::size_t count) const;
+    //! metodo retorna o nome do aluno 'index' da vista
+    std::string_view nome(std::size_t index) const;
+    //! metodo retorna a matricula do aluno 'index' da vista
+    std::int32_t matricula(std::size_t index) const;
+    //! metodo retorna a coluna de matriculas da vista (size() posicoes)
+    const std::int32_t* matriculas() const;
+    //! metodo copia a vista para uma Roster nova
+    Roster materialize() const;
+    //! metodo acrescenta a vista no fim de 'out'
+    void materialize_into(Roster& out) const;
+    //! metodo retorna o total de bytes dos nomes da vista
+    std::size_t name_size() const;
+    //! metodo retorna a quantidade de alunos
+    std::size_t size() const;
+    //! metodo verifica se esta vazia
+    bool empty() const;
+
+ private:
+    const Roster* roster_;
+    std::size_t begin_;
+    std::size_t end_;
+};
+
+//! CLASSE CONCATENACAO DE TURMAS
+/*!
+    Sequência de vistas (pedaços) tratada como uma turma só: concatenar
+    acrescenta pedaços, em O(número de pedaços), sem copiar alunos. O
+    acesso por posição faz busca binária nos tamanhos acumulados dos
+    pedaços; materialize() produz a cópia contígua quando ela for mesmo
+    necessária. As mesmas regras de vida das vistas valem aqui.
+*/
+class RosterRope {
+ public:
+    //! construtor vazio
+    RosterRope();
+    //! construtor com um pedaco
+    explicit RosterRope(RosterView view);
+    //! metodo acrescenta um pedaco no fim
+    void append(RosterView view);
+    //! metodo acrescenta todos os pedacos de 'other' no fim
+    void append(const RosterRope& other);
+    //! metodo retorna o nome do aluno 'index'
+    std::string_view nome(std::size_t index) const;
+    //! metodo retorna a matricula do aluno 'index'
+    std::int32_t matricula(std::size_t index) const;
+    //! metodo retorna o pedaco 'index'
+    RosterView chunk(std::size_t index) const;
+    //! metodo retorna a quantidade de pedacos
+    std::size_t chunk_count() const;
+    //! metodo copia todos os pedacos para uma Roster contigua
+    Roster materialize() const;
+    //! metodo retorna a quantidade de alunos
+    std::size_t size() const;
+    //! metodo verifica se esta vazia
+    bool empty() const;
+
+ private:
+    //! pedaco que contem 'index' (que passa a ser relativo ao pedaco)
+    const RosterView& locate(std::size_t& index) const;
+
+    std::vector<RosterView> chunks_;
+    std::vector<std::size_t> ends_;  // ends_[i]: alunos ate o pedaco i
+};
+
+//! (2) concatena duas vistas sem copiar alunos
+RosterRope turmas_uniao(RosterView t1, RosterView t2);
+//! (2) concatena duas concatenacoes sem copiar alunos
+RosterRope turmas_uniao(const RosterRope& t1, const RosterRope& t2);
+//! (3) divide 't' em t1 (os k primeiros) e t2 (o restante), em O(1)
+void turmas_divisao(RosterView t, std::size_t k, RosterView& t1,
+                    RosterView& t2);
+
+}  // namespace structures
+
+inline structures::RosterView::RosterView() {
+    roster_ = nullptr;
+    begin_ = 0;
+    end_ = 0;
+}
+
+inline structures::RosterView::RosterView(const Roster& roster) {
+    roster_ = &roster;
+    begin_ = 0;
+    end_ = roster.size();
+}
+
+inline structures::RosterView::RosterView(const Roster& roster,
+                                          std::size_t begin,
+                                          std::size_t end) {
+    if (begin > end || end > roster.size()) {
+        throw std::out_of_range("intervalo invalido");
+    }
+    roster_ = &roster;
+    begin_ = begin;
+    end_ = end;
+}
+
+inline structures::RosterView structures::RosterView::subview(
+        std::size_t begin, std::size_t count) const {
+    if (begin > size() || count > size() - begin) {
+        throw std::out_of_range("intervalo invalido");
+    }
+    RosterView view = *this;
+    view.begin_ = begin_ + begin;
+    view.end_ = view.begin_ + count;
+    return view;
+}
+
+inline std::string_view structures::RosterView::nome(
+        std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return roster_->nome(begin_ + index);
+}
+
+inline std::int32_t structures::RosterView::matricula(
+        std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return roster_->matricula(begin_ + index);
+}
+
+inline const std::int32_t* structures::RosterView::matriculas() const {
+    return roster_ == nullptr ? nullptr : roster_->matriculas() + begin_;
+}
+
+inline void structures::RosterView::materialize_into(Roster& out) const {
+    if (!empty()) {
+        out.append(*roster_, begin_, end_);
+    }
+}
+
+inline structures::Roster structures::RosterView::materialize() const {
+    Roster out;
+    materialize_into(out);
+    return out;
+}
+
+inline std::size_t structures::RosterView::name_size() const {
+    if (empty()) {
+        return 0;
+    }
+    const std::uint32_t* offsets = roster_->name_offsets();
+    return offsets[end_] - offsets[begin_];
+}
+
+inline std::size_t structures::RosterView::size() const {
+    return end_ - begin_;
+}
+
+inline bool structures::RosterView::empty() const {
+    return size() == 0;
+}
+
+inline structures::RosterRope::RosterRope() {}
+
+inline structures::RosterRope::RosterRope(RosterView view) {
+    append(view);
+}
+
+inline void structures::RosterRope::append(RosterView view) {
+    if (view.empty()) {
+        return;
+    }
+    chunks_.push_back(view);
+    ends_.push_back(size() + view.size());
+}
+
+inline void structures::RosterRope::append(const RosterRope& other) {
+    std::size_t count = other.chunk_count();  // 'other' pode ser *this
+    for (std::size_t i = 0; i < count; i++) {
+        append(other.chunks_[i]);
+    }
+}
+
+inline const structures::RosterView& structures::RosterRope::locate(
+        std::size_t& index) const {
+    if (index >= size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    std::size_t i = std::upper_bound(ends_.begin(), ends_.end(), index) -
+                    ends_.begin();
+    if (i > 0) {
+        index -= ends_[i - 1];
+    }
+    return chunks_[i];
+}
+
+inline std::string_view structures::RosterRope::nome(
+        std::size_t index) const {
+    const RosterView& view = locate(index);
+    return view.nome(index);
+}
+
+inline std::int32_t structures::RosterRope::matricula(
+        std::size_t index) const {
+    const RosterView& view = locate(index);
+    return view.matricula(index);
+}
+
+inline structures::RosterView structures::RosterRope::chunk(
+        std::size_t index) const {
+    if (index >= chunk_count()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return chunks_[index];
+}
+
+inline std::size_t structures::RosterRope::chunk_count() const {
+    return chunks_.size();
+}
+
+inline structures::Roster structures::RosterRope::materialize() const {
+    std::size_t bytes = 0;
+    for (const RosterView& view : chunks_) {
+        bytes += view.name_size();
+    }
+    Roster out;
+    out.reserve(size(), bytes);
+    for (const RosterView& view : chunks_) {
+        view.materialize_into(out);
+    }
+    return out;
+}
+
+inline std::size_t structures::RosterRope::size() const {
+    return ends_.empty() ? 0 : ends_.back();
+}
+
+inline bool structures::RosterRope::empty() const {
+    return size() == 0;
+}
+
+inline structures::RosterRope structures::turmas_uniao(RosterView t1,
+                                                       RosterView t2) {
+    RosterRope tu(t1);
+    tu.append(t2);
+    return tu;
+}
+
+inline structures::RosterRope structures::turmas_uniao(const RosterRope& t1,
+                                                       const RosterRope& t2) {
+    RosterRope tu = t1;
+    tu.append(t2);
+    return tu;
+}
+
+inline void structures::turmas_divisao(RosterView t, std::size_t k,
+                                       RosterView& t1, RosterView& t2) {
+    if (k > t.size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    t1 = t.subview(0, k);
+    t2 = t.subview(k, t.size() - k);
+}
+
+#endif
@@ -0,0 +1,177 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! match() de BracketValidator: confere o indice denso e os pares
+//! (BracketPairs) contra uma pilha de posicoes, inclusive em textos com
+//! erro e com literais; depois mede o custo de montar cada indice frente a
+//! validate e o de achar o fechamento de uma abertura (indice, busca
+//! binaria nos pares ou varredura contando a profundidade).
+//!
+//!     g++ -std=c++17 -O2 -march=native bench_bracket_match.cpp -o bench_bm
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./bracket_validator.h"
+
+using structures::BracketPairs;
+
+std::string random_code(std::mt19937& rng, std::size_t n, std::size_t depth) {
+    std::string text, closes;
+    while (text.size() < n) {
+        int kind = rng() % 10;
+        if (kind < 3 && closes.size() < depth) {
+            text += "([{"[kind];
+            closes += ")]}"[kind];
+        } else if (kind < 6 && !closes.empty()) {
+            text += closes.back();
+            closes.pop_back();
+        } else {
+            text += " x+1;\n"[rng() % 6];
+        }
+    }
+    text.append(closes.rbegin(), closes.rend());
+    return text;
+}
+
+// pares por uma pilha de posicoes; para no primeiro erro
+std::vector<std::uint32_t> reference(const std::string& text, bool& ok) {
+    std::vector<std::uint32_t> index(text.size(), BracketPairs::NO_MATCH);
+    std::vector<std::uint32_t> opens;
+    ok = true;
+    for (std::uint32_t i = 0; i < text.size(); i++) {
+        char c = text[i];
+        if (c == '(' || c == '[' || c == '{') {
+            opens.push_back(i);
+        } else if (c == ')' || c == ']' || c == '}') {
+            char want = c == ')' ? '(' : c == ']' ? '[' : '{';
+            if (opens.empty() || text[opens.back()] != want) {
+                ok = false;
+                return index;
+            }
+            index[opens.back()] = i;
+            index[i] = opens.back();
+            opens.pop_back();
+        }
+    }
+    ok = opens.empty();
+    return index;
+}
+
+void check() {
+    std::mt19937 rng(39);
+    structures::BracketOptions plain;
+    plain.skip_literals = false;
+    structures::BracketValidator validator(plain);
+    std::vector<std::uint32_t> index;
+    BracketPairs pairs;
+    for (int round = 0; round < 5000; round++) {
+        std::string text = random_code(rng, rng() % 2000, 1 + rng() % 80);
+        if (round % 3 == 1 && !text.empty()) {
+            text.insert(rng() % text.size(), 1, "([{)]}"[rng() % 6]);
+        }
+        bool ok;
+        std::vector<std::uint32_t> expected = reference(text, ok);
+        assert(validator.match(text, index) == ok);
+        assert(validator.match(text, pairs) == ok);
+        if (!ok) {
+            continue;  // o indice so vale ate o erro
+        }
+        assert(index == expected);
+        assert(pairs.size() * 2 == static_cast<std::size_t>(
+            std::count_if(expected.begin(), expected.end(),
+                          [](std::uint32_t v) {
+                              return v != BracketPairs::NO_MATCH;
+                          })));
+        for (std::uint32_t i = 0; i < text.size(); i++) {
+            bool opens = text[i] == '(' || text[i] == '[' || text[i] == '{';
+            assert(pairs.closing(i) ==
+                   (opens ? expected[i] : BracketPairs::NO_MATCH));
+        }
+    }
+
+    structures::BracketValidator code;  // delimitadores em literais ignorados
+    std::string text = "f(\")\", '(') { /* } */ }";
+    assert(code.match(text, index));
+    assert(index[1] == 10 && index[10] == 1);
+    assert(index[12] == 22 && index[22] == 12);
+    assert(index[3] == BracketPairs::NO_MATCH);
+    assert(code.match(text, pairs) && pairs.size() == 2);
+    std::printf("match: ok\n");
+}
+
+// fechamento da abertura em 'position' contando a profundidade
+std::uint32_t scan(const std::string& text, std::uint32_t position) {
+    long depth = 0;
+    for (std::uint32_t i = position; i < text.size(); i++) {
+        char c = text[i];
+        depth += c == '(' || c == '[' || c == '{';
+        depth -= c == ')' || c == ']' || c == '}';
+        if (depth == 0) {
+            return i;
+        }
+    }
+    return BracketPairs::NO_MATCH;
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check();
+    std::mt19937 rng(1);
+    std::string text = random_code(rng, 128u << 20, 64);
+    structures::BracketOptions plain;
+    plain.skip_literals = false;
+    structures::BracketValidator validator(plain);
+    std::vector<std::uint32_t> index;
+    BracketPairs pairs;
+    double gb = text.size() / 1e9;
+    std::printf("%zu MB\n", text.size() >> 20);
+    double took_validate = seconds([&] { validator.validate(text); });
+    double took_index = seconds([&] { validator.match(text, index); });
+    double took_pairs = seconds([&] { validator.match(text, pairs); });
+    std::printf("validate            %6.2f GB/s\n", gb / took_validate);
+    std::printf("match(indice)       %6.2f GB/s  %zu MB de indice\n",
+                gb / took_index, index.size() * 4 >> 20);
+    std::printf("match(pares)        %6.2f GB/s  %zu MB de pares\n",
+                gb / took_pairs, pairs.size() * 8 >> 20);
+
+    // fechamento de aberturas sorteadas (as de fora sao as mais caras)
+    std::vector<std::uint32_t> queries;
+    for (int i = 0; i < 100000; i++) {
+        queries.push_back(pairs.open[rng() % pairs.size()]);
+    }
+    std::uint64_t sums[3] = {0, 0, 0};
+    double took[3];
+    took[0] = seconds([&] {
+        for (auto q : queries) sums[0] += index[q];
+    });
+    took[1] = seconds([&] {
+        for (auto q : queries) sums[1] += pairs.closing(q);
+    });
+    std::size_t scanned = 1000;  // a varredura e lenta demais para todas
+    took[2] = seconds([&] {
+        for (std::size_t i = 0; i < scanned; i++) {
+            sums[2] += scan(text, queries[i]);
+        }
+    });
+    std::uint64_t check_sum = 0;
+    for (std::size_t i = 0; i < scanned; i++) {
+        check_sum += index[queries[i]];
+    }
+    assert(sums[0] == sums[1] && sums[2] == check_sum);
+    std::printf("achar fechamento: indice %.1f ns  pares %.1f ns  "
+                "varredura %.1f ns\n", took[0] / queries.size() * 1e9,
+                took[1] / queries.size() * 1e9, took[2] / scanned * 1e9);
+    return 0;
+}
@@ -0,0 +1,147 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! validate_parallel de BracketValidator (modo so-chaves): confere que o
+//! resultado, o byte e a linha do erro sao os mesmos de validate em textos
+//! com o erro em qualquer trecho, que uma falha ao criar threads relanca
+//! depois de esperar as ja criadas (sem sanitizadores), e mede GB/s com 1,
+//! 2, 4 e 8 threads.
+//!
+//!     g++ -std=c++17 -O2 -march=native -pthread bench_bracket_parallel.cpp
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sys/resource.h>
+#endif
+
+#include "./bracket_validator.h"
+
+// chaves balanceadas no meio de texto comum, em ate 'depth' niveis
+std::string braces(std::mt19937& rng, std::size_t n, std::size_t depth) {
+    std::string text;
+    text.reserve(n);
+    std::size_t open = 0;
+    while (text.size() < n) {
+        unsigned kind = rng() % 16;
+        if (kind == 0 && open < depth) {
+            text += '{';
+            open++;
+        } else if (kind == 1 && open > 0) {
+            text += '}';
+            open--;
+        } else {
+            text += kind == 2 ? '\n' : 'a' + kind;
+        }
+    }
+    text.append(open, '}');
+    return text;
+}
+
+void check() {
+    std::mt19937 rng(38);
+    structures::BracketOptions options;
+    options.all_kinds = false;
+    options.skip_literals = false;
+    structures::BracketValidator serial(options), parallel(options);
+    const std::size_t n = 3 << 20;  // acima do minimo para usar threads
+    for (int round = 0; round < 40; round++) {
+        std::string text = braces(rng, n + rng() % 1000, 1 + rng() % 100);
+        if (round % 4 == 1) {  // '}' sobrando em algum ponto
+            text.insert(rng() % text.size(), 1, '}');
+        } else if (round % 4 == 2) {  // '{' sem fechar
+            text.insert(rng() % text.size(), 1, '{');
+        } else if (round % 4 == 3) {  // erro perto do fim
+            text.insert(text.size() - rng() % 100, 2, '}');
+        }
+        bool expected = serial.validate(text);
+        for (unsigned threads : {1u, 2u, 3u, 8u}) {
+            assert(parallel.validate_parallel(text, threads) == expected);
+            assert(parallel.error_offset() == serial.error_offset());
+            assert(parallel.error_line() == serial.error_line());
+        }
+    }
+    std::printf("validate_parallel: ok\n");
+}
+
+#if defined(__linux__) && !defined(__SANITIZE_ADDRESS__) && \
+    !defined(__SANITIZE_THREAD__)
+//! pilhas de 1 GiB e espaco de enderecamento limitado: so as primeiras
+//! threads sao criadas; validate_parallel precisa esperar essas e relancar
+void check_spawn_failure() {
+    std::mt19937 rng(1);
+    std::string text = braces(rng, 4 << 20, 16);
+    structures::BracketOptions options;
+    options.all_kinds = false;
+    options.skip_literals = false;
+    structures::BracketValidator validator(options);
+    pthread_attr_t attr, previous;
+    pthread_getattr_default_np(&previous);
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, std::size_t(1) << 30);
+    pthread_setattr_default_np(&attr);
+    struct rlimit limit, saved;
+    getrlimit(RLIMIT_AS, &saved);
+    limit = saved;
+    limit.rlim_cur = std::size_t(3) << 30;  // + o que o processo ja usa
+    {
+        std::FILE* statm = std::fopen("/proc/self/statm", "r");
+        unsigned long pages = 0;
+        if (statm != nullptr && std::fscanf(statm, "%lu", &pages) == 1) {
+            limit.rlim_cur += pages * 4096;
+        }
+        if (statm != nullptr) {
+            std::fclose(statm);
+        }
+    }
+    setrlimit(RLIMIT_AS, &limit);
+    bool threw = false;
+    try {
+        validator.validate_parallel(text, 16);
+    } catch (const std::system_error&) {
+        threw = true;
+    }
+    setrlimit(RLIMIT_AS, &saved);
+    pthread_setattr_default_np(&previous);
+    pthread_attr_destroy(&attr);
+    pthread_attr_destroy(&previous);
+    assert(threw);
+    assert(validator.validate_parallel(text, 4));  // continua utilizavel
+    std::printf("validate_parallel com falha ao criar thread: ok\n");
+}
+#else
+void check_spawn_failure() {}
+#endif
+
+int main() {
+    check();
+    check_spawn_failure();
+    std::mt19937 rng(1);
+    std::string text = braces(rng, 512u << 20, 64);
+    structures::BracketOptions options;
+    options.all_kinds = false;
+    options.skip_literals = false;
+    structures::BracketValidator validator(options);
+    auto measure = [&](unsigned threads) {
+        auto start = std::chrono::steady_clock::now();
+        bool ok = threads == 0 ? validator.validate(text) :
+                  validator.validate_parallel(text, threads);
+        std::chrono::duration<double> took =
+            std::chrono::steady_clock::now() - start;
+        assert(ok);
+        (void) ok;
+        return text.size() / took.count() / 1e9;
+    };
+    std::printf("%zu MB, %u nucleos\n", text.size() >> 20,
+                std::thread::hardware_concurrency());
+    std::printf("validate            %6.2f GB/s\n", measure(0));
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        std::printf("validate_parallel %u %6.2f GB/s\n", threads,
+                    measure(threads));
+    }
+    return 0;
+}
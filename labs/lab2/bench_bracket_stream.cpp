@@ -0,0 +1,136 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! feed/finish, validate(istream) e validate_file de BracketValidator:
+//! confere que cortar a entrada em qualquer ponto (inclusive no meio de
+//! literais, escapes e comentarios) da o mesmo resultado, byte e linha do
+//! erro que validar o texto inteiro, e mede GB/s de cada forma de leitura
+//! com pedacos de 4 KB a 1 MB e um arquivo de 256 MB.
+//!
+//!     g++ -std=c++17 -O2 -march=native bench_bracket_stream.cpp -o bench_bs
+//!     ./bench_bs [arquivo temporario, padrao /tmp/bench_bracket_stream.txt]
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "./bracket_validator.h"
+
+// codigo valido com literais e comentarios que contem delimitadores
+std::string code(std::mt19937& rng, std::size_t n) {
+    static const char* tokens[] = {
+        " int x = a + b;", " s = \"(]\\\"{\";", " c = '}';", " e = '\\'';",
+        " // f(x]\n", " /* { [ */", "\n    ", " return x / 2;"
+    };
+    std::string text, closes;
+    while (text.size() < n) {
+        int kind = rng() % 10;
+        if (kind < 3 && closes.size() < 64) {
+            text += "([{"[kind];
+            closes += ")]}"[kind];
+        } else if (kind < 6 && !closes.empty()) {
+            text += closes.back();
+            closes.pop_back();
+        } else {
+            text += tokens[rng() % 8];
+        }
+    }
+    text.append(closes.rbegin(), closes.rend());
+    return text;
+}
+
+void check() {
+    std::mt19937 rng(37);
+    structures::BracketValidator whole, pieces;
+    for (int round = 0; round < 3000; round++) {
+        std::string text = code(rng, rng() % 2000);
+        if (round % 2 && !text.empty()) {  // metade com um erro inserido
+            text.insert(rng() % text.size(), 1, "([{)]}"[rng() % 6]);
+        }
+        bool expected = whole.validate(text);
+        pieces.reset();
+        for (std::size_t begin = 0; begin < text.size();) {
+            std::size_t length = 1 + rng() % (round % 3 ? 7 : 130);
+            length = std::min(length, text.size() - begin);
+            pieces.feed(std::string_view(text).substr(begin, length));
+            begin += length;
+        }
+        assert(pieces.finish() == expected);
+        assert(pieces.failed() == whole.failed());
+        if (!expected) {
+            assert(pieces.error_offset() == whole.error_offset());
+            assert(pieces.error_line() == whole.error_line());
+        }
+        std::istringstream input(text);
+        assert(pieces.validate(input, 1 + rng() % 100) == expected);
+    }
+    std::printf("feed/finish: ok\n");
+}
+
+double gbps(std::size_t bytes, double seconds) {
+    return bytes / seconds / 1e9;
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    bool result = work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    assert(result);
+    (void) result;
+    return took.count();
+}
+
+int main(int argc, char** argv) {
+    check();
+    const char* path = argc > 1 ? argv[1] : "/tmp/bench_bracket_stream.txt";
+    std::mt19937 rng(1);
+    std::string text = code(rng, 256u << 20);
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    // arquivo mapeado em janelas de uma pagina: mesmo resultado
+    structures::BracketValidator validator;
+    std::string small = text.substr(0, 1 << 20);
+    {
+        std::string small_path = std::string(path) + ".small";
+        std::ofstream out(small_path, std::ios::binary);
+        out.write(small.data(), static_cast<std::streamsize>(small.size()));
+        out.close();
+        bool expected = validator.validate(small);
+        assert(validator.validate_file(small_path.c_str(), 4096) == expected);
+        std::remove(small_path.c_str());
+    }
+
+    std::printf("%zu MB\n", text.size() >> 20);
+    std::printf("validate(texto inteiro)   %6.2f GB/s\n",
+                gbps(text.size(), seconds([&] {
+                    return validator.validate(text);
+                })));
+    for (std::size_t chunk : {4096u, 65536u, 1u << 20}) {
+        double took = seconds([&] {
+            validator.reset();
+            for (std::size_t begin = 0; begin < text.size(); begin += chunk) {
+                validator.feed(std::string_view(text).substr(begin, chunk));
+            }
+            return validator.finish();
+        });
+        std::printf("feed de %7zu bytes      %6.2f GB/s\n", chunk,
+                    gbps(text.size(), took));
+    }
+    std::printf("validate(ifstream, 1 MB)  %6.2f GB/s\n",
+                gbps(text.size(), seconds([&] {
+                    std::ifstream input(path, std::ios::binary);
+                    return validator.validate(input);
+                })));
+    std::printf("validate_file(64 MB)      %6.2f GB/s\n",
+                gbps(text.size(), seconds([&] {
+                    return validator.validate_file(path);
+                })));
+    std::remove(path);
+    return 0;
+}
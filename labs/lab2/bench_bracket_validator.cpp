@@ -0,0 +1,171 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! verificaChaves e BracketValidator::validate: confere verificaChaves
+//! contra a versao original com ArrayStack (aberturas sobrando sao
+//! aceitas), validate contra uma pilha simples byte a byte, e mede GB/s
+//! de cada um em 64 MB de texto com cara de codigo.
+//!
+//!     g++ -std=c++17 -O2 -march=native bench_bracket_validator.cpp -o bench_bv
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./vpl4.h"
+#include "./vpl5.h"
+
+// versao original de verificaChaves (com capacidade para o teste)
+bool verificaChaves_pilha(const std::string& trecho_programa) {
+    bool resposta = true;
+    int tamanho = trecho_programa.length();
+    structures::ArrayStack<char> pilha(trecho_programa.size() + 1);
+
+    for (int i = 0; i < tamanho; i++) {
+        if (trecho_programa[i] == '{') {
+            pilha.push(trecho_programa[i]);
+        } else if (trecho_programa[i] == '}') {
+            if (pilha.empty()) {
+                resposta = false;
+                break;
+            } else if (pilha.top() == '{') {
+                pilha.pop();
+            } else {
+                resposta = false;
+                break;
+            }
+        }
+    }
+
+    return resposta;
+}
+
+// ( ) [ ] { } aninhados, sem tratar literais, com uma pilha byte a byte
+bool reference(const std::string& text) {
+    std::vector<char> expected;
+    for (char c : text) {
+        if (c == '(' || c == '[' || c == '{') {
+            expected.push_back(c == '(' ? ')' : c == '[' ? ']' : '}');
+        } else if (c == ')' || c == ']' || c == '}') {
+            if (expected.empty() || expected.back() != c) {
+                return false;
+            }
+            expected.pop_back();
+        }
+    }
+    return expected.empty();
+}
+
+std::string random_text(std::mt19937& rng, std::size_t n,
+                        const std::string& alphabet) {
+    std::string text(n, ' ');
+    for (auto& c : text) {
+        c = alphabet[rng() % alphabet.size()];
+    }
+    return text;
+}
+
+// texto balanceado com todos os delimitadores, em ate 'depth' niveis; os
+// literais e comentarios nao contem delimitadores, entao o texto e valido
+// com e sem skip_literals
+std::string balanced(std::mt19937& rng, std::size_t n, std::size_t depth) {
+    static const char* tokens[] = {
+        " int x = a + b;", " s = \"texto\";", " c = 'z';", " // nota\n",
+        " /* bloco */", "\n    ", " return x * 2;", " y = x;"
+    };
+    std::string text, closes;
+    while (text.size() < n) {
+        int kind = rng() % 10;
+        if (kind < 3 && closes.size() < depth) {
+            text += "([{"[kind];
+            closes += ")]}"[kind];
+        } else if (kind < 6 && !closes.empty()) {
+            text += closes.back();
+            closes.pop_back();
+        } else {
+            text += tokens[rng() % 8];
+        }
+    }
+    text.append(closes.rbegin(), closes.rend());
+    return text;
+}
+
+void check() {
+    assert(verificaChaves("{"));
+    assert(verificaChaves("{{}"));
+    assert(verificaChaves("{{{"));
+    assert(verificaChaves(""));
+    assert(!verificaChaves("}"));
+    assert(!verificaChaves("{}}{"));
+    std::mt19937 rng(36);
+    for (int round = 0; round < 20000; round++) {
+        std::size_t n = rng() % 300;
+        std::string text = random_text(rng, n, round % 2 ? "{}x" : "{{}}x\n");
+        assert(verificaChaves(text) == verificaChaves_pilha(text));
+        // so aberturas por muito tempo: caminho por contagem de bits
+        std::string deep = std::string(rng() % 200, '{') + text;
+        assert(verificaChaves(deep) == verificaChaves_pilha(deep));
+    }
+
+    structures::BracketOptions plain;
+    plain.skip_literals = false;
+    structures::BracketValidator validator(plain);
+    for (int round = 0; round < 20000; round++) {
+        std::string text = round % 2 ?
+            random_text(rng, rng() % 300, "()[]{}ab\n") :
+            balanced(rng, rng() % 300, 1 + rng() % 40);
+        if (round % 5 == 0 && !text.empty()) {
+            text[rng() % text.size()] = "([{)]}"[rng() % 6];
+        }
+        assert(validator.validate(text) == reference(text));
+    }
+
+    structures::BracketValidator code;  // com literais e comentarios
+    assert(code.validate("f(\"(\", ')', /* { */ x) // ]"));
+    assert(code.validate("s = \"\\\"(\"; c = '\\'';"));
+    assert(!code.validate("f(\"(\", ')' x"));
+    assert(!code.validate("a[/* ] */ 1)"));
+    for (int round = 0; round < 200; round++) {
+        assert(code.validate(balanced(rng, rng() % 3000, 1 + rng() % 40)));
+    }
+    std::printf("verificaChaves/validate: ok\n");
+}
+
+template<typename Work>
+double gbps(std::size_t bytes, Work work) {
+    auto start = std::chrono::steady_clock::now();
+    bool result = work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    assert(result);  // o texto e valido em todos os modos
+    (void) result;
+    return bytes / took.count() / 1e9;
+}
+
+int main() {
+    check();
+    std::mt19937 rng(1);
+    std::string text = balanced(rng, 64 << 20, 64);
+    std::string braces;  // o mesmo texto com todo delimitador virando chave
+    for (char c : text) {
+        braces += c == '(' || c == '[' ? '{' : c == ')' || c == ']' ? '}' : c;
+    }
+    std::printf("%zu MB, maximo de 64 niveis\n", text.size() >> 20);
+    std::printf("verificaChaves (ArrayStack)  %6.2f GB/s\n",
+                gbps(braces.size(), [&] {
+                    return verificaChaves_pilha(braces);
+                }));
+    std::printf("verificaChaves (blocos)      %6.2f GB/s\n",
+                gbps(braces.size(), [&] { return verificaChaves(braces); }));
+    structures::BracketOptions plain;
+    plain.skip_literals = false;
+    structures::BracketValidator all(plain);
+    std::printf("validate ( ) [ ] { }         %6.2f GB/s\n",
+                gbps(text.size(), [&] { return all.validate(text); }));
+    std::printf("pilha byte a byte            %6.2f GB/s\n",
+                gbps(text.size(), [&] { return reference(text); }));
+    structures::BracketValidator code;
+    std::printf("validate com literais        %6.2f GB/s\n",
+                gbps(text.size(), [&] { return code.validate(text); }));
+    return 0;
+}
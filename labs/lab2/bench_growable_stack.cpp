@@ -0,0 +1,186 @@
+// Copyright [2019] <Luan da Silva Moraes>
+//! GrowableStack contra std::stack (sobre std::vector e std::deque) e
+//! ArrayStack: confere as operacoes com um std::vector, que so os slots
+//! ocupados guardam objetos vivos e que pop() move o topo; depois mede
+//! pilhas rasas criadas aos milhoes (buffer interno, sem alocacao) e uma
+//! pilha profunda que cresce ate 10M elementos.
+//!
+//!     g++ -std=c++17 -O2 bench_growable_stack.cpp -o bench_growable_stack
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <random>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "./growable_stack.h"
+#include "./vpl4.h"
+
+// conta objetos vivos para conferir construcoes e destruicoes
+struct Counted {
+    static int alive;
+    int value;
+    explicit Counted(int v = 0) : value(v) { alive++; }
+    Counted(const Counted& other) : value(other.value) { alive++; }
+    Counted(Counted&& other) noexcept : value(other.value) { alive++; }
+    Counted& operator=(const Counted&) = default;
+    ~Counted() { alive--; }
+};
+int Counted::alive = 0;
+
+void check() {
+    std::mt19937 rng(35);
+    {
+        structures::GrowableStack<std::string, 4> stack;
+        std::vector<std::string> mirror;
+        for (int op = 0; op < 100000; op++) {
+            std::string value = std::to_string(op) + std::string(op % 30, 'x');
+            switch (rng() % 5) {
+            case 0:
+            case 1:
+                stack.push(value);
+                mirror.push_back(value);
+                break;
+            case 2:
+                stack.emplace(3, 'e');
+                mirror.emplace_back(3, 'e');
+                break;
+            case 3:
+                if (!mirror.empty()) {
+                    assert(stack.pop() == mirror.back());
+                    mirror.pop_back();
+                }
+                break;
+            default:
+                if (!mirror.empty()) {
+                    assert(stack.top() == mirror.back());
+                }
+            }
+            assert(stack.size() == mirror.size());
+            assert(stack.capacity() >= stack.size());
+        }
+    }
+    {
+        structures::GrowableStack<Counted, 8> stack;
+        assert(Counted::alive == 0);  // buffer interno nao constroi nada
+        for (int i = 0; i < 100; i++) {
+            stack.emplace(i);
+            assert(Counted::alive == i + 1);
+        }
+        assert(stack.pop().value == 99);
+        assert(Counted::alive == 99);
+        stack.reserve(1000);
+        assert(Counted::alive == 99);
+        stack.clear();
+        assert(Counted::alive == 0 && stack.empty());
+        stack.emplace(1);
+    }
+    assert(Counted::alive == 0);
+    {
+        structures::GrowableStack<std::unique_ptr<int>> owned;
+        for (int i = 0; i < 50; i++) {
+            owned.push(std::make_unique<int>(i));
+        }
+        for (int i = 49; i >= 0; i--) {
+            assert(*owned.pop() == i);
+        }
+    }
+    std::printf("GrowableStack: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+// adapta as pilhas a uma interface comum (pop() de std::stack e void)
+template<typename Stack>
+int take(Stack& stack) {
+    int value = stack.top();
+    stack.pop();
+    return value;
+}
+
+// 'rounds' pilhas novas, cada uma com ate 'depth' elementos
+template<typename Stack>
+long long shallow(std::size_t rounds, int depth) {
+    long long sum = 0;
+    for (std::size_t r = 0; r < rounds; r++) {
+        Stack stack;
+        for (int i = 0; i < depth; i++) {
+            stack.push(i);
+        }
+        while (!stack.empty()) {
+            sum += take(stack);
+        }
+    }
+    return sum;
+}
+
+// uma pilha que cresce ate 'n' e esvazia
+template<typename Stack>
+long long deep(Stack& stack, std::size_t n) {
+    long long sum = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        stack.push(static_cast<int>(i));
+    }
+    while (!stack.empty()) {
+        sum += take(stack);
+    }
+    return sum;
+}
+
+using Growable = structures::GrowableStack<int, 16>;
+using VectorStack = std::stack<int, std::vector<int>>;
+using DequeStack = std::stack<int, std::deque<int>>;
+
+struct Fixed : structures::ArrayStack<int> {  // capacidade fixa de 16
+    Fixed() : structures::ArrayStack<int>(16) {}
+};
+
+int main() {
+    check();
+    const std::size_t rounds = 2000000;
+    const int depth = 12;
+    long long sums[4];
+    double took[4];
+    took[0] = seconds([&] { sums[0] = shallow<Growable>(rounds, depth); });
+    took[1] = seconds([&] { sums[1] = shallow<VectorStack>(rounds, depth); });
+    took[2] = seconds([&] { sums[2] = shallow<DequeStack>(rounds, depth); });
+    took[3] = seconds([&] { sums[3] = shallow<Fixed>(rounds, depth); });
+    assert(sums[0] == sums[1] && sums[1] == sums[2] && sums[2] == sums[3]);
+    std::printf("%zu pilhas de %d: GrowableStack %.3f s  "
+                "stack<vector> %.3f s  stack<deque> %.3f s  "
+                "ArrayStack(16) %.3f s\n", rounds, depth, took[0], took[1],
+                took[2], took[3]);
+
+    const std::size_t n = 10000000;
+    {
+        Growable stack;
+        took[0] = seconds([&] { sums[0] = deep(stack, n); });
+    }
+    {
+        VectorStack stack;
+        took[1] = seconds([&] { sums[1] = deep(stack, n); });
+    }
+    {
+        DequeStack stack;
+        took[2] = seconds([&] { sums[2] = deep(stack, n); });
+    }
+    {
+        structures::ArrayStack<int> stack(n);
+        took[3] = seconds([&] { sums[3] = deep(stack, n); });
+    }
+    assert(sums[0] == sums[1] && sums[1] == sums[2] && sums[2] == sums[3]);
+    std::printf("pilha de %zu: GrowableStack %.3f s  stack<vector> %.3f s  "
+                "stack<deque> %.3f s  ArrayStack(n) %.3f s\n", n, took[0],
+                took[1], took[2], took[3]);
+    return 0;
+}
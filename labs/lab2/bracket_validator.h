@@ -0,0 +1,751 @@
+// Copyright [2022] <Luan da Silva Moraes>
+#ifndef STRUCTURES_BRACKET_VALIDATOR_H
+#define STRUCTURES_BRACKET_VALIDATOR_H
+
+#include <algorithm>  // std::min, std::max
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::uint64_t
+#include <cstring>  // std::memcpy
+#include <istream>  // std::istream
+#include <stdexcept>  // C++ exceptions
+#include <string_view>  // std::string_view
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>  // open
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <sys/stat.h>  // fstat
+#include <unistd.h>  // close, sysconf
+#else
+#include <fstream>  // std::ifstream
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "./growable_stack.h"
+
+namespace structures {
+
+//! opcoes da validacao de delimitadores
+struct BracketOptions {
+    //! true: ( ) [ ] { }; false: apenas { }
+    bool all_kinds = true;
+    //! ignora delimitadores em "strings", 'caracteres' e comentarios
+    bool skip_literals = true;
+};
+
+//! pares de delimitadores, na ordem das aberturas (modo economico)
+/*!
+    Ocupa 8 bytes por par, independente do tamanho do texto; a busca pelo
+    fechamento de uma abertura é binária.
+*/
+struct BracketPairs {
+    //! posicao sem par (abertura nao fechada)
+    static constexpr std::uint32_t NO_MATCH = 0xFFFFFFFFu;
+
+    std::vector<std::uint32_t> open;  // crescente
+    std::vector<std::uint32_t> close;  // close[k] fecha open[k]
+
+    //! metodo retorna o fechamento da abertura em 'position' (ou NO_MATCH)
+    std::uint32_t closing(std::uint32_t position) const {
+        auto it = std::lower_bound(open.begin(), open.end(), position);
+        if (it == open.end() || *it != position) {
+            return NO_MATCH;
+        }
+        return close[it - open.begin()];
+    }
+    //! metodo retorna quantos pares (ou aberturas sem par) existem
+    std::size_t size() const {
+        return open.size();
+    }
+};
+
+namespace detail {
+
+//! classes de cada posicao de um bloco de 64 bytes (bit i = byte i)
+struct BlockMasks {
+    std::uint64_t open;
+    std::uint64_t close;
+    std::uint64_t special;  // " ' / * \ e quebra de linha
+    std::uint64_t newline;  // sempre calculada, para contar linhas
+};
+
+inline int popcount(std::uint64_t bits) {
+    return __builtin_popcountll(bits);
+}
+
+inline int lowest_bit(std::uint64_t bits) {
+    return __builtin_ctzll(bits);
+}
+
+#if defined(__AVX2__)
+//! bits dos bytes iguais a 'c' em dois vetores de 32 bytes
+inline std::uint64_t equal_mask(__m256i low, __m256i high, char c) {
+    __m256i needle = _mm256_set1_epi8(c);
+    std::uint32_t lo = static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needle)));
+    std::uint32_t hi = static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needle)));
+    return lo | (static_cast<std::uint64_t>(hi) << 32);
+}
+
+//! classifica 64 bytes de uma vez
+inline BlockMasks classify(const char* block, const BracketOptions& options) {
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    __m256i high = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(block + 32));
+    BlockMasks masks;
+    masks.open = equal_mask(low, high, '{');
+    masks.close = equal_mask(low, high, '}');
+    masks.newline = equal_mask(low, high, '\n');
+    masks.special = 0;
+    if (options.all_kinds) {
+        masks.open |= equal_mask(low, high, '(') | equal_mask(low, high, '[');
+        masks.close |= equal_mask(low, high, ')') | equal_mask(low, high, ']');
+    }
+    if (options.skip_literals) {
+        masks.special = equal_mask(low, high, '"') |
+                        equal_mask(low, high, '\'') |
+                        equal_mask(low, high, '/') |
+                        equal_mask(low, high, '*') |
+                        equal_mask(low, high, '\\') | masks.newline;
+    }
+    return masks;
+}
+#elif defined(__SSE2__)
+//! bits dos bytes iguais a 'c' em quatro vetores de 16 bytes
+inline std::uint64_t equal_mask(const __m128i* v, char c) {
+    __m128i needle = _mm_set1_epi8(c);
+    std::uint64_t bits = 0;
+    for (int i = 0; i < 4; i++) {
+        std::uint64_t part = static_cast<std::uint16_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(v[i], needle)));
+        bits |= part << (16 * i);
+    }
+    return bits;
+}
+
+//! classifica 64 bytes de uma vez
+inline BlockMasks classify(const char* block, const BracketOptions& options) {
+    __m128i v[4];
+    for (int i = 0; i < 4; i++) {
+        v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+    }
+    BlockMasks masks;
+    masks.open = equal_mask(v, '{');
+    masks.close = equal_mask(v, '}');
+    masks.newline = equal_mask(v, '\n');
+    masks.special = 0;
+    if (options.all_kinds) {
+        masks.open |= equal_mask(v, '(') | equal_mask(v, '[');
+        masks.close |= equal_mask(v, ')') | equal_mask(v, ']');
+    }
+    if (options.skip_literals) {
+        masks.special = equal_mask(v, '"') | equal_mask(v, '\'') |
+                        equal_mask(v, '/') | equal_mask(v, '*') |
+                        equal_mask(v, '\\') | masks.newline;
+    }
+    return masks;
+}
+#else
+//! classifica 64 bytes de uma vez (sem SIMD)
+inline BlockMasks classify(const char* block, const BracketOptions& options) {
+    BlockMasks masks = {0, 0, 0, 0};
+    for (int i = 0; i < 64; i++) {
+        std::uint64_t bit = static_cast<std::uint64_t>(1) << i;
+        switch (block[i]) {
+        case '{':
+            masks.open |= bit;
+            break;
+        case '}':
+            masks.close |= bit;
+            break;
+        case '(': case '[':
+            masks.open |= options.all_kinds ? bit : 0;
+            break;
+        case ')': case ']':
+            masks.close |= options.all_kinds ? bit : 0;
+            break;
+        case '\n':
+            masks.newline |= bit;
+            masks.special |= options.skip_literals ? bit : 0;
+            break;
+        case '"': case '\'': case '/': case '*': case '\\':
+            masks.special |= options.skip_literals ? bit : 0;
+            break;
+        default:
+            break;
+        }
+    }
+    return masks;
+}
+#endif
+
+//! resumo de um trecho no modo so-chaves (sem tratar literais)
+struct BraceSummary {
+    std::uint64_t unmatched_close;  // '}' sem '{' correspondente no trecho
+    std::uint64_t unmatched_open;  // '{' que sobram abertos no fim do trecho
+    std::uint64_t newlines;
+};
+
+//! resume um trecho: com profundidade inicial d, o trecho e valido se
+//! d >= unmatched_close e termina com d - unmatched_close + unmatched_open
+inline BraceSummary summarize_braces(const char* data, std::size_t size) {
+    BracketOptions options;
+    options.all_kinds = false;
+    options.skip_literals = false;
+
+    std::int64_t depth = 0;
+    std::int64_t lowest = 0;
+    std::uint64_t newlines = 0;
+    for (std::size_t i = 0; i < size; i += 64) {
+        char padded[64] = {};
+        const char* block = data + i;
+        if (size - i < 64) {
+            std::memcpy(padded, block, size - i);
+            block = padded;
+        }
+        BlockMasks masks = classify(block, options);
+        newlines += popcount(masks.newline);
+        int closes = popcount(masks.close);
+        if (depth - closes >= lowest) {  // o minimo nao muda neste bloco
+            depth += popcount(masks.open) - closes;
+            continue;
+        }
+        std::uint64_t bits = masks.open | masks.close;
+        while (bits != 0) {
+            std::uint64_t bit = bits & (~bits + 1);
+            depth += (masks.open & bit) != 0 ? 1 : -1;
+            lowest = depth < lowest ? depth : lowest;
+            bits &= bits - 1;
+        }
+    }
+    BraceSummary summary;
+    summary.unmatched_close = static_cast<std::uint64_t>(-lowest);
+    summary.unmatched_open = static_cast<std::uint64_t>(depth - lowest);
+    summary.newlines = newlines;
+    return summary;
+}
+
+}  // namespace detail
+
+//! CLASSE VALIDADOR DE DELIMITADORES
+/*!
+    Verifica se ( ) [ ] { } estão balanceados e corretamente aninhados.
+    A entrada é classificada 64 bytes por vez (AVX2 ou SSE2 quando
+    disponíveis); só os bytes relevantes de cada bloco são visitados. No
+    modo só-chaves, blocos sem literais nem risco de fechar abaixo de zero
+    são resolvidos por contagem de bits, sem percorrer os bytes.
+
+    A entrada também pode ser consumida aos pedaços (feed/finish): todo o
+    estado (pilha, literal ou comentário em aberto) atravessa as fronteiras
+    entre pedaços, e a memória usada não depende do tamanho da entrada, só
+    da profundidade de aninhamento. Em caso de erro, error_offset() e
+    error_line() indicam o byte e a linha (a partir de 1) do primeiro
+    delimitador inválido; se faltar fechar algo, apontam para o fim.
+
+    validate_parallel divide o texto em trechos resumidos em paralelo
+    (fechamentos sem par, aberturas sobrando); uma varredura dos resumos
+    encontra o primeiro trecho inválido, que é então percorrido para
+    localizar o erro exato. Só vale para o modo só-chaves (apenas
+    chaves, sem literais): com literais, o estado no início de um trecho
+    depende de todo o texto anterior.
+*/
+class BracketValidator {
+ public:
+    //! construtor
+    explicit BracketValidator(BracketOptions options = BracketOptions());
+    //! metodo valida um texto inteiro
+    bool validate(std::string_view text);
+    //! metodo valida um texto inteiro com 'threads' threads (0: todas)
+    bool validate_parallel(std::string_view text, unsigned threads = 0);
+    //! metodo valida e, para cada delimitador, guarda a posicao do par
+    /*!
+        index[i] recebe a posição do par do delimitador em i, ou
+        BracketPairs::NO_MATCH (outros bytes e aberturas sem par). Usa 4
+        bytes por byte do texto; em caso de erro, o índice vale até ele.
+    */
+    bool match(std::string_view text, std::vector<std::uint32_t>& index);
+    //! metodo valida e guarda so os pares, na ordem das aberturas
+    bool match(std::string_view text, BracketPairs& pairs);
+    //! metodo valida um fluxo, lendo 'buffer_size' bytes por vez
+    bool validate(std::istream& input, std::size_t buffer_size = 1 << 20);
+    //! metodo valida um arquivo, mapeado em janelas de 'window' bytes
+    bool validate_file(const char* path, std::size_t window = 64 << 20);
+    //! metodo recomeca uma validacao aos pedacos
+    void reset();
+    //! metodo processa o proximo pedaco; false se ja ha erro
+    bool feed(std::string_view chunk);
+    //! metodo encerra a entrada; true se tudo estava balanceado
+    bool finish();
+    //! metodo verifica se ha erro
+    bool failed() const;
+    //! metodo retorna o byte do primeiro erro
+    std::uint64_t error_offset() const;
+    //! metodo retorna a linha do primeiro erro
+    std::uint64_t error_line() const;
+    //! metodo retorna quantos bytes ja foram processados
+    std::uint64_t consumed() const;
+
+ private:
+    enum class State {
+        CODE,
+        SLASH,  // '/' em codigo, pode iniciar comentario
+        LINE_COMMENT,
+        BLOCK_COMMENT,
+        BLOCK_STAR,  // '*' em comentario de bloco, pode fecha-lo
+        STRING,  // dentro de "..." ou '...'
+        ESCAPE  // '\' dentro de literal
+    };
+
+    //! processa um trecho; a posicao absoluta do inicio e 'offset_'
+    void scan(const char* data, std::size_t size);
+    //! processa um bloco de 64 bytes ja classificado
+    void scan_block(const char* block, const detail::BlockMasks& masks);
+    //! processa um byte relevante na posicao absoluta 'pos'
+    void step(char c, std::uint64_t pos);
+    //! trata um delimitador em codigo
+    void bracket(char c, std::uint64_t pos);
+    //! marca erro na posicao 'pos' (se ainda nao houver erro)
+    void fail(std::uint64_t pos);
+    //! verifica se match() esta guardando pares
+    bool recording() const {
+        return index_ != nullptr || pairs_ != nullptr;
+    }
+    //! guarda a abertura em 'pos'
+    void record_open(std::uint64_t pos);
+    //! guarda o fechamento em 'pos' da abertura do topo
+    void record_close(std::uint64_t pos);
+
+    BracketOptions options_;
+    State state_;
+    char quote_;  // delimitador do literal atual
+    std::uint64_t pending_;  // posicao do '/', '*' ou '\' pendente
+    std::uint64_t depth_;  // profundidade no modo so-chaves
+    GrowableStack<char, 64> expected_;  // fechamentos esperados (todos)
+    GrowableStack<std::uint32_t, 64> opens_;  // aberturas, em match()
+    std::vector<std::uint32_t>* index_;  // destino de match() (denso)
+    BracketPairs* pairs_;  // destino de match() (economico)
+    std::uint64_t offset_;  // bytes ja processados
+    std::uint64_t lines_;  // quebras de linha ja processadas
+    bool error_;
+    std::uint64_t error_offset_;
+    std::uint64_t error_line_;
+
+    //! abaixo disso validate_parallel nao cria threads
+    static const std::size_t PARALLEL_MIN_SIZE = 1u << 20;
+    //! trechos por thread (equilibra threads mais lentas)
+    static const std::size_t CHUNKS_PER_THREAD = 4;
+    //! maior texto cujas posicoes cabem em std::uint32_t
+    static constexpr std::uint64_t MATCH_MAX_SIZE = 0xFFFFFFFFu;
+};
+
+//! valida os delimitadores de um texto inteiro
+inline bool validate_brackets(std::string_view text,
+                              BracketOptions options = BracketOptions());
+
+}  // namespace structures
+
+inline structures::BracketValidator::BracketValidator(BracketOptions options) {
+    options_ = options;
+    state_ = State::CODE;
+    quote_ = 0;
+    pending_ = 0;
+    depth_ = 0;
+    offset_ = 0;
+    lines_ = 0;
+    error_ = false;
+    error_offset_ = 0;
+    error_line_ = 0;
+    index_ = nullptr;
+    pairs_ = nullptr;
+}
+
+inline void structures::BracketValidator::reset() {
+    state_ = State::CODE;
+    depth_ = 0;
+    expected_.clear();
+    opens_.clear();
+    offset_ = 0;
+    lines_ = 0;
+    error_ = false;
+    error_offset_ = 0;
+    error_line_ = 0;
+}
+
+inline bool structures::BracketValidator::feed(std::string_view chunk) {
+    if (!error_) {
+        scan(chunk.data(), chunk.size());
+    }
+    return !error_;
+}
+
+inline bool structures::BracketValidator::finish() {
+    if (!error_ && (depth_ != 0 || !expected_.empty())) {
+        fail(offset_);  // delimitador aberto ate o fim
+        error_line_ = lines_ + 1;
+    }
+    return !error_;
+}
+
+inline bool structures::BracketValidator::validate(std::string_view text) {
+    reset();
+    feed(text);
+    return finish();
+}
+
+inline bool structures::BracketValidator::validate_parallel(
+        std::string_view text, unsigned threads) {
+    if (options_.all_kinds || options_.skip_literals ||
+        text.size() < PARALLEL_MIN_SIZE) {
+        return validate(text);
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // trechos multiplos de 64 bytes, como os blocos de 'scan'
+    std::size_t chunk = text.size() / (threads * CHUNKS_PER_THREAD) + 1;
+    chunk = (chunk + 63) / 64 * 64;
+    std::size_t count = (text.size() + chunk - 1) / chunk;
+    if (threads > count) {
+        threads = static_cast<unsigned>(count);
+    }
+
+    std::vector<detail::BraceSummary> summaries(count);
+    std::atomic<std::size_t> next{0};
+    auto worker = [&] {
+        for (std::size_t i = next++; i < count; i = next++) {
+            std::size_t begin = i * chunk;
+            summaries[i] = detail::summarize_braces(
+                text.data() + begin, std::min(chunk, text.size() - begin));
+        }
+    };
+    std::vector<std::thread> pool;
+    try {
+        for (unsigned t = 1; t < threads; t++) {
+            pool.emplace_back(worker);
+        }
+    } catch (...) {
+        // as threads ja criadas leem 'summaries' e 'text': espera antes
+        for (auto& thread : pool) {
+            thread.join();
+        }
+        throw;
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    reset();
+    for (std::size_t i = 0; i < count; i++) {
+        const detail::BraceSummary& summary = summaries[i];
+        if (depth_ < summary.unmatched_close) {
+            // o erro esta neste trecho: percorre so ele
+            std::size_t begin = i * chunk;
+            scan(text.data() + begin, std::min(chunk, text.size() - begin));
+            return finish();
+        }
+        depth_ += summary.unmatched_open - summary.unmatched_close;
+        lines_ += summary.newlines;
+        offset_ += std::min(chunk, text.size() - i * chunk);
+    }
+    return finish();
+}
+
+inline bool structures::BracketValidator::match(
+        std::string_view text, std::vector<std::uint32_t>& index) {
+    if (text.size() >= MATCH_MAX_SIZE) {
+        throw std::out_of_range("texto grande demais para o indice");
+    }
+    index.assign(text.size(), BracketPairs::NO_MATCH);
+    reset();
+    index_ = &index;
+    feed(text);
+    index_ = nullptr;
+    return finish();
+}
+
+inline bool structures::BracketValidator::match(std::string_view text,
+                                                BracketPairs& pairs) {
+    if (text.size() >= MATCH_MAX_SIZE) {
+        throw std::out_of_range("texto grande demais para o indice");
+    }
+    pairs.open.clear();
+    pairs.close.clear();
+    reset();
+    pairs_ = &pairs;
+    feed(text);
+    pairs_ = nullptr;
+    return finish();
+}
+
+inline void structures::BracketValidator::record_open(std::uint64_t pos) {
+    if (index_ != nullptr) {
+        opens_.push(static_cast<std::uint32_t>(pos));
+    } else {
+        // a pilha guarda o numero do par; o fechamento e preenchido depois
+        opens_.push(static_cast<std::uint32_t>(pairs_->open.size()));
+        pairs_->open.push_back(static_cast<std::uint32_t>(pos));
+        pairs_->close.push_back(BracketPairs::NO_MATCH);
+    }
+}
+
+inline void structures::BracketValidator::record_close(std::uint64_t pos) {
+    std::uint32_t top = opens_.pop();
+    if (index_ != nullptr) {
+        (*index_)[top] = static_cast<std::uint32_t>(pos);
+        (*index_)[pos] = top;
+    } else {
+        pairs_->close[top] = static_cast<std::uint32_t>(pos);
+    }
+}
+
+inline bool structures::BracketValidator::validate(std::istream& input,
+                                                   std::size_t buffer_size) {
+    if (buffer_size == 0) {
+        throw std::out_of_range("tamanho de buffer invalido");
+    }
+    std::vector<char> buffer(buffer_size);
+    reset();
+    while (input && !error_) {
+        input.read(buffer.data(), buffer.size());
+        feed(std::string_view(buffer.data(),
+                              static_cast<std::size_t>(input.gcount())));
+    }
+    return finish();
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+inline bool structures::BracketValidator::validate_file(const char* path,
+                                                        std::size_t window) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("arquivo nao pode ser aberto");
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("arquivo nao pode ser lido");
+    }
+
+    // janelas alinhadas a pagina: so uma fica mapeada por vez
+    std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    window = window < page ? page : window - window % page;
+    std::uint64_t size = static_cast<std::uint64_t>(info.st_size);
+
+    reset();
+    for (std::uint64_t begin = 0; begin < size && !error_; begin += window) {
+        std::size_t length = static_cast<std::size_t>(
+            size - begin < window ? size - begin : window);
+        void* map = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd,
+                           static_cast<off_t>(begin));
+        if (map == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("arquivo nao pode ser mapeado");
+        }
+        ::madvise(map, length, MADV_SEQUENTIAL);
+        feed(std::string_view(static_cast<const char*>(map), length));
+        ::munmap(map, length);
+    }
+    ::close(fd);
+    return finish();
+}
+#else
+inline bool structures::BracketValidator::validate_file(const char* path,
+                                                        std::size_t window) {
+    std::ifstream input(path, std::ios::binary);
+    if (!input) {
+        throw std::runtime_error("arquivo nao pode ser aberto");
+    }
+    return validate(input, window);
+}
+#endif
+
+inline bool structures::BracketValidator::failed() const {
+    return error_;
+}
+
+inline std::uint64_t structures::BracketValidator::error_offset() const {
+    return error_offset_;
+}
+
+inline std::uint64_t structures::BracketValidator::error_line() const {
+    return error_line_;
+}
+
+inline std::uint64_t structures::BracketValidator::consumed() const {
+    return offset_;
+}
+
+inline void structures::BracketValidator::fail(std::uint64_t pos) {
+    if (!error_) {
+        error_ = true;
+        error_offset_ = pos;
+    }
+}
+
+inline void structures::BracketValidator::scan(const char* data,
+                                               std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 64 <= size && !error_; i += 64) {
+        scan_block(data + i, detail::classify(data + i, options_));
+        offset_ += 64;
+    }
+    if (i < size && !error_) {
+        // resto menor que um bloco: completa com zeros (nao relevantes)
+        char block[64] = {};
+        std::memcpy(block, data + i, size - i);
+        scan_block(block, detail::classify(block, options_));
+        offset_ += size - i;
+    }
+}
+
+inline void structures::BracketValidator::scan_block(
+        const char* block, const detail::BlockMasks& masks) {
+    if (!options_.all_kinds && masks.special == 0 && state_ == State::CODE &&
+        !recording()) {
+        // so chaves e nenhum literal: basta contar, se nao ficar negativo
+        int closes = detail::popcount(masks.close);
+        if (depth_ >= static_cast<std::uint64_t>(closes)) {
+            depth_ += detail::popcount(masks.open) - closes;
+            lines_ += detail::popcount(masks.newline);
+            return;
+        }
+    }
+
+    std::uint64_t bits = masks.open | masks.close | masks.special;
+    while (bits != 0 && !error_) {
+        int i = detail::lowest_bit(bits);
+        step(block[i], offset_ + i);
+        bits &= bits - 1;
+    }
+    if (error_ && error_line_ == 0) {  // erro neste bloco
+        std::uint64_t before = (static_cast<std::uint64_t>(1) <<
+                                (error_offset_ - offset_)) - 1;
+        error_line_ = lines_ + detail::popcount(masks.newline & before) + 1;
+    }
+    lines_ += detail::popcount(masks.newline);
+}
+
+inline void structures::BracketValidator::step(char c, std::uint64_t pos) {
+    switch (state_) {
+    case State::SLASH:
+        if (pos == pending_ + 1 && c == '/') {
+            state_ = State::LINE_COMMENT;
+            return;
+        }
+        if (pos == pending_ + 1 && c == '*') {
+            state_ = State::BLOCK_COMMENT;
+            return;
+        }
+        state_ = State::CODE;  // era uma divisao: trata 'c' como codigo
+        break;
+    case State::LINE_COMMENT:
+        if (c == '\n') {
+            state_ = State::CODE;
+        }
+        return;
+    case State::BLOCK_STAR:
+        if (pos == pending_ + 1 && c == '/') {
+            state_ = State::CODE;
+            return;
+        }
+        state_ = State::BLOCK_COMMENT;
+        // fallthrough
+    case State::BLOCK_COMMENT:
+        if (c == '*') {
+            state_ = State::BLOCK_STAR;
+            pending_ = pos;
+        }
+        return;
+    case State::ESCAPE:
+        state_ = State::STRING;
+        if (pos == pending_ + 1) {  // 'c' e o caractere escapado
+            return;
+        }
+        // fallthrough
+    case State::STRING:
+        if (c == '\\') {
+            state_ = State::ESCAPE;
+            pending_ = pos;
+        } else if (c == quote_ || c == '\n') {
+            state_ = State::CODE;
+        }
+        return;
+    case State::CODE:
+        break;
+    }
+
+    switch (c) {
+    case '"': case '\'':
+        state_ = State::STRING;
+        quote_ = c;
+        break;
+    case '/':
+        state_ = State::SLASH;
+        pending_ = pos;
+        break;
+    case '*': case '\\': case '\n':
+        break;
+    default:
+        bracket(c, pos);
+        break;
+    }
+}
+
+inline void structures::BracketValidator::bracket(char c, std::uint64_t pos) {
+    bool matched = false;
+    if (!options_.all_kinds) {
+        if (c == '{') {
+            depth_++;
+        } else if (depth_ == 0) {
+            fail(pos);
+        } else {
+            depth_--;
+            matched = true;
+        }
+    } else {
+        switch (c) {
+        case '(':
+            expected_.push(')');
+            break;
+        case '[':
+            expected_.push(']');
+            break;
+        case '{':
+            expected_.push('}');
+            break;
+        default:  // fechamento
+            if (expected_.empty() || expected_.top() != c) {
+                fail(pos);
+            } else {
+                expected_.pop();
+                matched = true;
+            }
+            break;
+        }
+    }
+
+    if (recording()) {
+        if (matched) {
+            record_close(pos);
+        } else if (!error_) {
+            record_open(pos);
+        }
+    }
+}
+
+inline bool structures::validate_brackets(std::string_view text,
+                                          BracketOptions options) {
+    BracketValidator validator(options);
+    return validator.validate(text);
+}
+
+#endif
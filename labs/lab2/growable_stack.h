@@ -0,0 +1,165 @@
+// Copyright [2019] <Luan da Silva Moraes>
+#ifndef STRUCTURES_GROWABLE_STACK_H
+#define STRUCTURES_GROWABLE_STACK_H
+
+#include <cstdint>  // std::size_t
+#include <new>  // placement new
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move, std::forward
+
+namespace structures {
+
+template<typename T, std::size_t N = 16>
+//! CLASSE PILHA QUE CRESCE
+/*!
+    Pilha em vetor sem capacidade máxima: dobra o vetor quando enche. Os
+    N primeiros elementos ficam dentro do próprio objeto (nenhuma alocação
+    para pilhas rasas); só as posições ocupadas têm objetos construídos, e
+    pop() move o topo para fora.
+*/
+class GrowableStack {
+ public:
+    //! construtor simples
+    GrowableStack();
+    //! destrutor
+    ~GrowableStack();
+    GrowableStack(const GrowableStack&) = delete;
+    GrowableStack& operator=(const GrowableStack&) = delete;
+    //! metodo empilha (copia)
+    void push(const T& data);
+    //! metodo empilha (move)
+    void push(T&& data);
+    //! metodo constroi o novo topo no lugar
+    template<typename... Args>
+    T& emplace(Args&&... args);
+    //! metodo desempilha (move o topo para fora)
+    T pop();
+    //! metodo retorna o topo
+    T& top();
+    //! metodo limpa pilha
+    void clear();
+    //! metodo garante espaco para 'capacity' elementos
+    void reserve(std::size_t capacity);
+    //! metodo retorna tamanho
+    std::size_t size() const;
+    //! metodo retorna capacidade atual
+    std::size_t capacity() const;
+    //! verifica se esta vazia
+    bool empty() const;
+
+ private:
+    //! verifica se os elementos estao no buffer interno
+    bool is_inline() const {
+        return m_contents == reinterpret_cast<const T*>(m_inline);
+    }
+    //! troca o vetor por um de 'capacity' posicoes, movendo os elementos
+    void reallocate(std::size_t capacity);
+
+    T* m_contents;
+    std::size_t m_size;
+    std::size_t m_capacity;
+    alignas(T) unsigned char m_inline[N > 0 ? N * sizeof(T) : 1];
+};
+
+}  // namespace structures
+
+template<typename T, std::size_t N>
+structures::GrowableStack<T, N>::GrowableStack() {
+    m_contents = reinterpret_cast<T*>(m_inline);
+    m_size = 0;
+    m_capacity = N;
+}
+
+template<typename T, std::size_t N>
+structures::GrowableStack<T, N>::~GrowableStack() {
+    clear();
+    if (!is_inline()) {
+        ::operator delete(m_contents);
+    }
+}
+
+template<typename T, std::size_t N>
+void structures::GrowableStack<T, N>::reallocate(std::size_t capacity) {
+    T* bigger = static_cast<T*>(::operator new(capacity * sizeof(T)));
+    for (std::size_t i = 0; i < m_size; i++) {
+        new (bigger + i) T(std::move(m_contents[i]));
+        m_contents[i].~T();
+    }
+    if (!is_inline()) {
+        ::operator delete(m_contents);
+    }
+    m_contents = bigger;
+    m_capacity = capacity;
+}
+
+template<typename T, std::size_t N>
+void structures::GrowableStack<T, N>::reserve(std::size_t capacity) {
+    if (capacity > m_capacity) {
+        reallocate(capacity);
+    }
+}
+
+template<typename T, std::size_t N>
+void structures::GrowableStack<T, N>::push(const T& data) {
+    emplace(data);
+}
+
+template<typename T, std::size_t N>
+void structures::GrowableStack<T, N>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+T& structures::GrowableStack<T, N>::emplace(Args&&... args) {
+    if (m_size == m_capacity) {
+        // os argumentos podem referenciar elementos da propria pilha
+        T data(std::forward<Args>(args)...);
+        reallocate(m_capacity > 0 ? 2 * m_capacity : 1);
+        return *new (m_contents + m_size++) T(std::move(data));
+    }
+    return *new (m_contents + m_size++) T(std::forward<Args>(args)...);
+}
+
+template<typename T, std::size_t N>
+T structures::GrowableStack<T, N>::pop() {
+    if (empty()) {
+        throw std::out_of_range("pilha vazia");
+    }
+    T* last = m_contents + --m_size;
+    T data = std::move(*last);
+    last->~T();
+    return data;
+}
+
+template<typename T, std::size_t N>
+T& structures::GrowableStack<T, N>::top() {
+    if (empty()) {
+        throw std::out_of_range("pilha vazia");
+    }
+    return m_contents[m_size - 1];
+}
+
+template<typename T, std::size_t N>
+void structures::GrowableStack<T, N>::clear() {
+    while (m_size > 0) {
+        m_contents[--m_size].~T();
+    }
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::GrowableStack<T, N>::size() const {
+    return m_size;
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::GrowableStack<T, N>::capacity() const {
+    return m_capacity;
+}
+
+template<typename T, std::size_t N>
+bool structures::GrowableStack<T, N>::empty() const {
+    return m_size == 0;
+}
+
+#endif
@@ -4,6 +4,7 @@
 
 #include <cstdint>  // std::size_t
 #include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move
 
 namespace structures {
 
@@ -36,7 +37,7 @@ class ArrayStack {
 
  private:
     T* m_contents;
-    int m_top;
+    std::size_t m_size;  // quantidade empilhada (topo em m_size - 1)
     std::size_t m_max_size;
 
     static const auto DEFAULT_SIZE = 10u;
@@ -51,14 +52,14 @@ template<typename T>
 structures::ArrayStack<T>::ArrayStack() {
     m_max_size = DEFAULT_SIZE;
     m_contents = new T[m_max_size];
-    m_top = -1;
+    m_size = 0;
 }
 
 template<typename T>
 structures::ArrayStack<T>::ArrayStack(std::size_t max) {
     m_max_size = max;
     m_contents = new T[m_max_size];
-    m_top = -1;
+    m_size = 0;
 }
 
 template<typename T>
@@ -71,7 +72,7 @@ void structures::ArrayStack<T>::push(const T& data) {
     if (full()) {
         throw std::out_of_range("pilha cheia");
     } else {
-        m_contents[++m_top] = data;
+        m_contents[m_size++] = data;
     }
 }
 
@@ -80,7 +81,7 @@ T structures::ArrayStack<T>::pop() {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     } else {
-        return m_contents[m_top--];
+        return std::move(m_contents[--m_size]);
     }
 }
 
@@ -89,18 +90,18 @@ T& structures::ArrayStack<T>::top() {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     } else {
-        return m_contents[m_top];
+        return m_contents[m_size - 1];
     }
 }
 
 template<typename T>
 void structures::ArrayStack<T>::clear() {
-    m_top = -1;
+    m_size = 0;
 }
 
 template<typename T>
 std::size_t structures::ArrayStack<T>::size() {
-    return m_top + 1;
+    return m_size;
 }
 
 template<typename T>
@@ -110,11 +111,11 @@ std::size_t structures::ArrayStack<T>::max_size() {
 
 template<typename T>
 bool structures::ArrayStack<T>::empty() {
-    return m_top == -1;
+    return m_size == 0;
 }
 
 template<typename T>
 bool structures::ArrayStack<T>::full() {
-    return m_top == static_cast<int>(m_max_size) - 1;
+    return m_size == m_max_size;
 }
 
@@ -1,28 +1,14 @@
 // Copyright [2022] <Luan da Silva Moraes>
-#include <string>
-#include "./array_stack.h"
-
-bool verificaChaves(std::string trecho_programa) {
-    bool resposta = true;
-    int tamanho = trecho_programa.length();
-    structures::ArrayStack<char> pilha(500);
-
-    for (int i = 0; i < tamanho; i++) {
-        if (trecho_programa[i] == '{') {
-            pilha.push(trecho_programa[i]);
-        } else if (trecho_programa[i] == '}') {
-            if (pilha.empty()) {
-                resposta = false;
-                break;
-            } else if (pilha.top() == '{') {
-                pilha.pop();
-            } else {
-                resposta = false;
-                break;
-            }
-        }
-    }
-
-    return resposta;
+#include <string_view>
+#include "./bracket_validator.h"
+
+bool verificaChaves(std::string_view trecho_programa) {
+    // como na versao com ArrayStack<char>(500): falso apenas se algum '}'
+    // nao tiver '{' aberto antes dele; '{' que sobram abertos no fim sao
+    // aceitos ("{", "{{}" e "{{{" sao verdadeiros). Sem o limite de 500
+    // niveis, em que a versao antiga lancava excecao.
+    auto resumo = structures::detail::summarize_braces(
+        trecho_programa.data(), trecho_programa.size());
+
+    return resumo.unmatched_close == 0;
 }
-
@@ -2,8 +2,10 @@
 #ifndef STRUCTURES_ARRAY_QUEUE_H
 #define STRUCTURES_ARRAY_QUEUE_H
 
+#include <algorithm>  // std::copy, std::move
 #include <cstdint>  // std::size_t
 #include <stdexcept>  // C++ Exceptions
+#include <utility>  // std::move
 
 namespace structures {
 
@@ -34,7 +36,37 @@ class ArrayQueue {
     //! metodo verifica se esta cheio
     bool full();
 
+    //! trecho contiguo do vetor circular
+    struct Span {
+        T* data;
+        std::size_t size;
+    };
+    //! ate dois trechos contiguos com os elementos, na ordem da fila
+    struct Spans {
+        Span first;
+        Span second;
+    };
+    //! metodo enfileira 'n' elementos de uma vez (todos ou nenhum)
+    void enqueue_bulk(const T* data, std::size_t n);
+    //! metodo desenfileira 'n' elementos de uma vez para 'data'
+    void dequeue_bulk(T* data, std::size_t n);
+    //! metodo expoe os elementos no lugar, sem desenfileirar
+    Spans peek_spans();
+    //! metodo descarta os 'n' primeiros (apos processa-los no lugar)
+    void drop(std::size_t n);
+    //! metodo retorna o elemento na posicao 'index' (0 e o inicio)
+    T& at(std::size_t index);
+    //! metodo leva os 'k' primeiros para o fim (como k x enqueue(dequeue()))
+    void rotate(std::size_t k);
+    //! metodo retira o elemento da posicao 'index'
+    T erase_at(std::size_t index);
+
  private:
+    //! indice no vetor da posicao 'index' da fila
+    std::size_t slot(std::size_t index) const {
+        return (begin_ + index) % max_size_;
+    }
+
     T* contents;
     std::size_t size_;
     std::size_t max_size_;
@@ -45,8 +77,6 @@ class ArrayQueue {
 
 }  // namespace structures
 
-#endif
-
 //! construtor padrao
 template<typename T>
 structures::ArrayQueue<T>::ArrayQueue() {
@@ -92,7 +122,7 @@ T structures::ArrayQueue<T>::dequeue() {
         throw std::out_of_range("Fila vazia");
     }
 
-    T data = contents[begin_];
+    T data = std::move(contents[begin_]);
     begin_ = (begin_ + 1) % max_size_;
     size_--;
 
@@ -141,3 +171,139 @@ bool structures::ArrayQueue<T>::full() {
     return size_ == max_size_;
 }
 
+//! metodo enfileira 'n' elementos de uma vez
+template<typename T>
+void structures::ArrayQueue<T>::enqueue_bulk(const T* data, std::size_t n) {
+    if (n > max_size_ - size_) {
+        throw std::out_of_range("Fila cheia");
+    }
+    if (n == 0) {
+        return;
+    }
+
+    // no maximo duas copias contiguas: ate o fim do vetor e do inicio
+    std::size_t start = (end_ + 1) % max_size_;
+    std::size_t first = std::min(n, max_size_ - start);
+    std::copy(data, data + first, contents + start);
+    std::copy(data + first, data + n, contents);
+    end_ = (start + n - 1) % max_size_;
+    size_ += n;
+}
+
+//! metodo desenfileira 'n' elementos de uma vez
+template<typename T>
+void structures::ArrayQueue<T>::dequeue_bulk(T* data, std::size_t n) {
+    if (n > size_) {
+        throw std::out_of_range("Fila vazia");
+    }
+
+    Spans spans = peek_spans();
+    std::size_t first = std::min(n, spans.first.size);
+    std::move(spans.first.data, spans.first.data + first, data);
+    std::move(spans.second.data, spans.second.data + (n - first),
+              data + first);
+    drop(n);
+}
+
+//! metodo expoe os elementos no lugar
+/*!
+    first começa no início da fila; second (possivelmente vazio) continua
+    a partir do índice 0 do vetor quando a fila dá a volta. Os ponteiros
+    valem até a próxima operação que altere a fila.
+*/
+template<typename T>
+typename structures::ArrayQueue<T>::Spans
+structures::ArrayQueue<T>::peek_spans() {
+    std::size_t first = std::min(size_, max_size_ - begin_);
+    Spans spans;
+    spans.first.data = contents + begin_;
+    spans.first.size = first;
+    spans.second.data = contents;
+    spans.second.size = size_ - first;
+    return spans;
+}
+
+//! metodo descarta os 'n' primeiros
+template<typename T>
+void structures::ArrayQueue<T>::drop(std::size_t n) {
+    if (n > size_) {
+        throw std::out_of_range("Fila vazia");
+    }
+
+    begin_ = (begin_ + n) % max_size_;
+    size_ -= n;
+}
+
+//! metodo retorna o elemento na posicao 'index'
+template<typename T>
+T& structures::ArrayQueue<T>::at(std::size_t index) {
+    if (index >= size_) {
+        throw std::out_of_range("Posicao invalida");
+    }
+
+    return contents[slot(index)];
+}
+
+//! metodo leva os 'k' primeiros para o fim
+/*!
+    Com a fila cheia basta deslocar os índices de início e fim, em O(1).
+    Caso contrário move apenas o menor dos lados: os k primeiros para o
+    fim ou os size() - k últimos para o início.
+*/
+template<typename T>
+void structures::ArrayQueue<T>::rotate(std::size_t k) {
+    if (size_ == 0) {
+        return;
+    }
+    k %= size_;
+    if (k == 0) {
+        return;
+    }
+
+    if (size_ == max_size_) {
+        begin_ = (begin_ + k) % max_size_;
+        end_ = (end_ + k) % max_size_;
+    } else if (k <= size_ - k) {
+        for (std::size_t i = 0; i < k; i++) {
+            end_ = (end_ + 1) % max_size_;
+            contents[end_] = std::move(contents[begin_]);
+            begin_ = (begin_ + 1) % max_size_;
+        }
+    } else {
+        for (std::size_t i = 0; i < size_ - k; i++) {
+            begin_ = (begin_ + max_size_ - 1) % max_size_;
+            contents[begin_] = std::move(contents[end_]);
+            end_ = (end_ + max_size_ - 1) % max_size_;
+        }
+    }
+}
+
+//! metodo retira o elemento da posicao 'index'
+/*!
+    Desloca o menor dos lados (os anteriores uma posição para frente ou os
+    posteriores uma posição para trás), mantendo a ordem dos demais.
+*/
+template<typename T>
+T structures::ArrayQueue<T>::erase_at(std::size_t index) {
+    if (index >= size_) {
+        throw std::out_of_range("Posicao invalida");
+    }
+
+    T data = std::move(contents[slot(index)]);
+    if (index < size_ - 1 - index) {
+        for (std::size_t i = index; i > 0; i--) {
+            contents[slot(i)] = std::move(contents[slot(i - 1)]);
+        }
+        begin_ = (begin_ + 1) % max_size_;
+    } else {
+        for (std::size_t i = index; i + 1 < size_; i++) {
+            contents[slot(i)] = std::move(contents[slot(i + 1)]);
+        }
+        end_ = (end_ + max_size_ - 1) % max_size_;
+    }
+    size_--;
+
+    return data;
+}
+
+#endif
@@ -0,0 +1,132 @@
+// Copyright [2018] <Luan da Silva Moraes>
+//! enqueue_bulk/dequeue_bulk/peek_spans de ArrayQueue: confere contra um
+//! std::deque (inclusive quando o lote da a volta no vetor circular) e
+//! compara a vazao em lotes de 1 a 4096 com o laco de enqueue/dequeue
+//! unitarios e com a soma feita no lugar por peek_spans + drop.
+//!
+//!     g++ -std=c++17 -O2 bench_array_queue_bulk.cpp -o bench_aq_bulk
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "./array_queue.cpp"
+
+void check() {
+    std::mt19937 rng(32);
+    structures::ArrayQueue<int> q(37);  // primo: lotes dao a volta em tudo
+    std::deque<int> mirror;
+    int next = 0;
+    std::vector<int> buffer(64);
+    for (int op = 0; op < 200000; op++) {
+        std::size_t n = rng() % 20;
+        if (rng() % 2) {
+            for (std::size_t i = 0; i < n; i++) {
+                buffer[i] = next + static_cast<int>(i);
+            }
+            if (n > q.max_size() - q.size()) {
+                bool threw = false;
+                try {
+                    q.enqueue_bulk(buffer.data(), n);
+                } catch (const std::out_of_range&) {
+                    threw = true;
+                }
+                assert(threw);  // tudo ou nada
+            } else {
+                q.enqueue_bulk(buffer.data(), n);
+                mirror.insert(mirror.end(), buffer.begin(), buffer.begin() + n);
+                next += static_cast<int>(n);
+            }
+        } else if (n <= q.size()) {
+            if (op % 3 == 0) {
+                auto spans = q.peek_spans();
+                assert(spans.first.size + spans.second.size == q.size());
+                for (std::size_t i = 0; i < q.size(); i++) {
+                    int v = i < spans.first.size ?
+                            spans.first.data[i] :
+                            spans.second.data[i - spans.first.size];
+                    assert(v == mirror[i]);
+                }
+                q.drop(n);
+            } else {
+                q.dequeue_bulk(buffer.data(), n);
+                for (std::size_t i = 0; i < n; i++) {
+                    assert(buffer[i] == mirror[i]);
+                }
+            }
+            mirror.erase(mirror.begin(), mirror.begin() + n);
+        }
+        assert(q.size() == mirror.size());
+    }
+    std::printf("ArrayQueue bulk: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+int main() {
+    check();
+    const std::size_t capacity = 8192;
+    const std::size_t total = 1 << 24;
+    std::vector<long long> in(4096), out(4096);
+    for (std::size_t i = 0; i < in.size(); i++) {
+        in[i] = static_cast<long long>(i);
+    }
+    std::printf("%-6s %16s %16s %16s\n", "lote", "unitario Mop/s",
+                "bulk Mop/s", "spans Mop/s");
+    for (std::size_t batch = 1; batch <= 4096; batch *= 4) {
+        structures::ArrayQueue<long long> q(capacity);
+        long long sums[3] = {0, 0, 0};
+        // começa no meio do vetor para os lotes darem a volta
+        for (std::size_t i = 0; i < capacity / 2 + 3; i++) {
+            q.enqueue(0);
+        }
+        q.drop(q.size());
+        double single = seconds([&] {
+            for (std::size_t done = 0; done < total; done += batch) {
+                for (std::size_t i = 0; i < batch; i++) {
+                    q.enqueue(in[i]);
+                }
+                for (std::size_t i = 0; i < batch; i++) {
+                    sums[0] += q.dequeue();
+                }
+            }
+        });
+        double bulk = seconds([&] {
+            for (std::size_t done = 0; done < total; done += batch) {
+                q.enqueue_bulk(in.data(), batch);
+                q.dequeue_bulk(out.data(), batch);
+                for (std::size_t i = 0; i < batch; i++) {
+                    sums[1] += out[i];
+                }
+            }
+        });
+        double spans = seconds([&] {
+            for (std::size_t done = 0; done < total; done += batch) {
+                q.enqueue_bulk(in.data(), batch);
+                auto s = q.peek_spans();
+                for (std::size_t i = 0; i < s.first.size; i++) {
+                    sums[2] += s.first.data[i];
+                }
+                for (std::size_t i = 0; i < s.second.size; i++) {
+                    sums[2] += s.second.data[i];
+                }
+                q.drop(batch);
+            }
+        });
+        assert(sums[0] == sums[1] && sums[1] == sums[2]);
+        std::printf("%-6zu %16.1f %16.1f %16.1f\n", batch,
+                    total / single / 1e6, total / bulk / 1e6,
+                    total / spans / 1e6);
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+// Copyright [2018] <Luan da Silva Moraes>
+//! BlockingQueue: confere entrega unica, espera com fila cheia, tempo
+//! limite, close() e enqueue_bulk interrompido por close(); depois mede
+//! vazao e percentis de latencia (p50, p99, p99.9) nas configuracoes 1:1,
+//! N:1 e 1:N, com dequeue unitario e com dequeue_bulk.
+//!
+//!     g++ -std=c++17 -O2 -pthread bench_blocking_queue.cpp -o bench_bq
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "./blocking_queue.h"
+
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
+
+void check() {
+    // fila de 1: o produtor so avanca quando o consumidor retira
+    structures::BlockingQueue<int> q(1);
+    const int n = 20000;
+    std::thread producer([&] {
+        for (int i = 0; i < n; i++) {
+            q.enqueue(i);
+        }
+        int rest[3] = {n, n + 1, n + 2};
+        assert(q.enqueue_bulk(rest, 3) == 3);
+        q.close();
+    });
+    std::vector<int> got;
+    int buffer[8];
+    for (;;) {
+        std::size_t k = q.dequeue_bulk(buffer, 8);
+        if (k == 0) {
+            break;
+        }
+        got.insert(got.end(), buffer, buffer + k);
+    }
+    producer.join();
+    assert(got.size() == static_cast<std::size_t>(n + 3));
+    for (int i = 0; i < n + 3; i++) {
+        assert(got[i] == i);
+    }
+    bool threw = false;
+    try {
+        q.enqueue(1);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw && q.closed());
+    threw = false;
+    try {
+        q.enqueue_bulk(buffer, 8);  // nada entrou: lanca
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // fechada no meio do lote: retorna quantos entraram
+    structures::BlockingQueue<int> partial(4);
+    int batch[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::size_t sent = 0;
+    std::thread bulk([&] { sent = partial.enqueue_bulk(batch, 10); });
+    std::vector<int> taken;
+    while (taken.size() < 4) {
+        std::size_t k = partial.dequeue_bulk(buffer, 4 - taken.size());
+        taken.insert(taken.end(), buffer, buffer + k);
+    }
+    // cheia de novo so com o produtor esperando por espaco para 8 e 9
+    while (partial.size() < 4) {
+        std::this_thread::yield();
+    }
+    partial.close();
+    bulk.join();
+    assert(sent == 8);
+    for (std::size_t k; (k = partial.dequeue_bulk(buffer, 8)) > 0;) {
+        taken.insert(taken.end(), buffer, buffer + k);
+    }
+    assert(taken == std::vector<int>(batch, batch + sent));
+
+    structures::BlockingQueue<int> timed(1);
+    int value;
+    assert(!timed.try_dequeue_for(value, std::chrono::milliseconds(5)));
+    assert(timed.try_enqueue_for(7, std::chrono::milliseconds(5)));
+    assert(!timed.try_enqueue_for(8, std::chrono::milliseconds(5)));
+    assert(timed.try_dequeue_for(value, std::chrono::milliseconds(5)));
+    assert(value == 7);
+    std::printf("BlockingQueue: ok\n");
+}
+
+void run(const char* name, unsigned producers, unsigned consumers,
+         std::size_t batch) {
+    const std::uint64_t total = 1000000;
+    structures::BlockingQueue<std::uint64_t> q(1024);
+    std::vector<std::vector<std::uint64_t>> samples(consumers);
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (unsigned p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            std::uint64_t mine = total / producers +
+                                 (p < total % producers ? 1 : 0);
+            for (std::uint64_t i = 0; i < mine; i++) {
+                q.enqueue(now_ns());
+            }
+        });
+    }
+    for (unsigned c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c] {
+            std::vector<std::uint64_t> buffer(batch);
+            std::uint64_t seen = 0;
+            for (;;) {
+                std::size_t k = q.dequeue_bulk(buffer.data(), batch);
+                if (k == 0) {
+                    return;  // fechada e vazia
+                }
+                std::uint64_t arrived = now_ns();
+                for (std::size_t i = 0; i < k; i++) {
+                    if (++seen % 16 == 0) {
+                        samples[c].push_back(arrived - buffer[i]);
+                    }
+                }
+            }
+        });
+    }
+    for (unsigned p = 0; p < producers; p++) {
+        threads[p].join();
+    }
+    q.close();
+    for (unsigned c = 0; c < consumers; c++) {
+        threads[producers + c].join();
+    }
+    std::chrono::duration<double> took = Clock::now() - start;
+    std::vector<std::uint64_t> all;
+    for (auto& s : samples) {
+        all.insert(all.end(), s.begin(), s.end());
+    }
+    std::sort(all.begin(), all.end());
+    auto pct = [&](double p) {
+        return all.empty() ? 0.0 :
+            all[static_cast<std::size_t>(p * (all.size() - 1))] / 1e3;
+    };
+    std::printf("%-4s (%u:%u) lote %-4zu %6.2f Mop/s  p50 %8.1f us  "
+                "p99 %8.1f us  p99.9 %8.1f us\n", name, producers,
+                consumers, batch, total / took.count() / 1e6, pct(0.5),
+                pct(0.99), pct(0.999));
+}
+
+int main() {
+    check();
+    const unsigned n = 4;
+    for (std::size_t batch : {1u, 64u}) {
+        run("1:1", 1, 1, batch);
+        run("N:1", n, 1, batch);
+        run("1:N", 1, n, batch);
+    }
+    return 0;
+}
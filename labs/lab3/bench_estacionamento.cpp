@@ -0,0 +1,135 @@
+// Copyright [2023] <Luan da Silva Moraes>
+//! rotate/erase_at/at de ArrayQueue e as rotinas de estacionamento.h:
+//! confere contra um std::deque e contra os lacos originais de
+//! enqueue(dequeue()) e mede as duas versoes em filas de 100K veiculos.
+//!
+//!     g++ -std=c++17 -O2 bench_estacionamento.cpp -o bench_estacionamento
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <random>
+
+#include "./array_queue.cpp"
+#include "./estacionamento.h"
+
+// versoes originais, movendo um veiculo por vez
+void retira_veiculo_laco(structures::ArrayQueue<int> *f, int k) {
+    for (int i = 0; i < k - 1; i++) {
+        f->enqueue(f->dequeue());
+    }
+    f->dequeue();
+}
+
+void mantenha_veiculo_laco(structures::ArrayQueue<int> *f, int k) {
+    int kElement;
+    for (int i = 0; i < k; i++) {
+        kElement = f->dequeue();
+    }
+    f->clear();
+    f->enqueue(kElement);
+}
+
+std::deque<int> contents(structures::ArrayQueue<int>& q) {
+    std::deque<int> out;
+    for (std::size_t i = 0; i < q.size(); i++) {
+        out.push_back(q.at(i));
+    }
+    return out;
+}
+
+void check() {
+    std::mt19937 rng(33);
+    for (int round = 0; round < 2000; round++) {
+        std::size_t capacity = 1 + rng() % 40;
+        structures::ArrayQueue<int> q(capacity);
+        std::deque<int> mirror;
+        // desloca o inicio para exercitar a volta do vetor circular
+        for (std::size_t i = rng() % capacity; i > 0; i--) {
+            q.enqueue(-1);
+            q.dequeue();
+        }
+        for (std::size_t i = rng() % (capacity + 1); i > 0; i--) {
+            int v = static_cast<int>(rng() % 1000);
+            q.enqueue(v);
+            mirror.push_back(v);
+        }
+        for (int op = 0; op < 20 && !mirror.empty(); op++) {
+            std::size_t k = rng() % (2 * mirror.size());
+            if (rng() % 2) {
+                q.rotate(k);
+                for (std::size_t i = 0; i < k; i++) {
+                    mirror.push_back(mirror.front());
+                    mirror.pop_front();
+                }
+            } else {
+                std::size_t index = k % mirror.size();
+                assert(q.erase_at(index) == mirror[index]);
+                mirror.erase(mirror.begin() + index);
+            }
+            assert(contents(q) == mirror);
+        }
+    }
+    for (int round = 0; round < 500; round++) {
+        std::size_t n = 1 + rng() % 50;
+        int k = 1 + static_cast<int>(rng() % n);
+        structures::ArrayQueue<int> a(n), b(n), c(n), d(n);
+        for (std::size_t i = 0; i < n; i++) {
+            int v = static_cast<int>(rng());
+            a.enqueue(v);
+            b.enqueue(v);
+            c.enqueue(v);
+            d.enqueue(v);
+        }
+        retira_veiculo(&a, k);
+        retira_veiculo_laco(&b, k);
+        assert(contents(a) == contents(b));
+        mantenha_veiculo(&c, k);
+        mantenha_veiculo_laco(&d, k);
+        assert(contents(c) == contents(d));
+    }
+    std::printf("rotate/erase_at/estacionamento: ok\n");
+}
+
+template<typename Routine>
+double seconds(Routine routine, std::size_t n, std::size_t capacity,
+               int repetitions) {
+    std::mt19937 rng(1);
+    double total = 0;
+    for (int r = 0; r < repetitions; r++) {
+        structures::ArrayQueue<int> q(capacity);
+        for (std::size_t i = 0; i < n; i++) {
+            q.enqueue(static_cast<int>(i));
+        }
+        int k = 1 + static_cast<int>(rng() % n);
+        auto start = std::chrono::steady_clock::now();
+        routine(&q, k);
+        std::chrono::duration<double> took =
+            std::chrono::steady_clock::now() - start;
+        total += took.count();
+    }
+    return total / repetitions;
+}
+
+int main() {
+    check();
+    const std::size_t n = 100000;
+    const int repetitions = 200;
+    std::printf("%zu veiculos, k aleatorio, media de %d chamadas\n",
+                n, repetitions);
+    // fila cheia: rotate so desloca indices; pela metade: move min(k, n-k)
+    for (std::size_t capacity : {n, 2 * n}) {
+        const char* kind = capacity == n ? "cheia" : "pela metade";
+        std::printf("%-11s retira_veiculo    laco %9.1f us  "
+                    "rotate %9.1f us\n", kind,
+                    seconds(retira_veiculo_laco, n, capacity,
+                            repetitions) * 1e6,
+                    seconds(retira_veiculo, n, capacity, repetitions) * 1e6);
+        std::printf("%-11s mantenha_veiculo  laco %9.1f us  "
+                    "at     %9.1f us\n", kind,
+                    seconds(mantenha_veiculo_laco, n, capacity,
+                            repetitions) * 1e6,
+                    seconds(mantenha_veiculo, n, capacity, repetitions) * 1e6);
+    }
+    return 0;
+}
@@ -0,0 +1,229 @@
+// Copyright [2018] <Luan da Silva Moraes>
+//! SpscQueue e MpmcQueue contra ArrayQueue protegida por mutex: confere
+//! ordem e entrega unica com varias threads e mede vazao e latencia
+//! (p50/p99 do tempo entre enfileirar e desenfileirar) para 1:1, 2:2 e
+//! 4:4 threads. Em maquinas com poucos nucleos as threads se revezam e as
+//! latencias incluem trocas de contexto.
+//!
+//!     g++ -std=c++17 -O2 -pthread bench_lockfree_queues.cpp -o bench_lfq
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "./array_queue.cpp"
+#include "./mpmc_queue.h"
+#include "./spsc_queue.h"
+
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
+
+void check_spsc() {
+    const std::uint64_t n = 2000000;
+    structures::SpscQueue<std::uint64_t> q(100);
+    std::thread producer([&] {
+        std::uint64_t batch[16];
+        for (std::uint64_t i = 0; i < n;) {
+            if (i % 3 == 0) {  // alterna unitario e em lote
+                std::size_t count = std::min<std::uint64_t>(16, n - i);
+                for (std::size_t k = 0; k < count; k++) {
+                    batch[k] = i + k;
+                }
+                std::size_t sent = q.try_enqueue_bulk(batch, count);
+                i += sent;
+                if (sent == 0) {
+                    std::this_thread::yield();
+                }
+            } else if (q.try_enqueue(i)) {
+                i++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::uint64_t expected = 0;
+    std::uint64_t batch[32];
+    while (expected < n) {
+        std::size_t got = q.try_dequeue_bulk(batch, 1 + expected % 32);
+        if (got == 0) {
+            std::this_thread::yield();
+        }
+        for (std::size_t k = 0; k < got; k++) {
+            assert(batch[k] == expected);
+            expected++;
+        }
+    }
+    producer.join();
+    assert(q.empty());
+    std::printf("SpscQueue: ok\n");
+}
+
+void check_mpmc() {
+    const unsigned producers = 3, consumers = 3;
+    const std::uint64_t n = 300000;
+    structures::MpmcQueue<std::uint64_t> q(64);
+    std::vector<std::atomic<int>> seen(producers * n);
+    std::atomic<std::uint64_t> consumed{0};
+    std::vector<std::thread> threads;
+    for (unsigned p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            for (std::uint64_t i = 0; i < n;) {
+                std::uint64_t values[4];
+                std::size_t count = std::min<std::uint64_t>(1 + i % 4, n - i);
+                for (std::size_t k = 0; k < count; k++) {
+                    values[k] = p * n + i + k;
+                }
+                std::size_t sent = q.try_enqueue_bulk(values, count);
+                i += sent;
+                if (sent == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (unsigned c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            std::vector<std::uint64_t> last(producers, 0);
+            std::vector<bool> any(producers, false);
+            while (consumed.load() < producers * n) {
+                std::uint64_t value;
+                if (!q.try_dequeue(value)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::uint64_t p = value / n;
+                // cada consumidor ve cada produtor em ordem crescente
+                assert(!any[p] || value > last[p]);
+                any[p] = true;
+                last[p] = value;
+                seen[value]++;
+                consumed++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& count : seen) {
+        assert(count.load() == 1);
+    }
+    std::printf("MpmcQueue: ok\n");
+}
+
+struct Result {
+    double mops;
+    double p50_us;
+    double p99_us;
+};
+
+//! 'producers' threads enviam 'per_producer' marcas de tempo cada
+template<typename Push, typename Pop>
+Result run(unsigned producers, unsigned consumers, std::uint64_t per_producer,
+           Push push, Pop pop) {
+    std::uint64_t total = producers * per_producer;
+    std::atomic<std::uint64_t> consumed{0};
+    std::vector<std::vector<std::uint64_t>> samples(consumers);
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (unsigned p = 0; p < producers; p++) {
+        threads.emplace_back([&] {
+            for (std::uint64_t i = 0; i < per_producer;) {
+                if (push(now_ns())) {
+                    i++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (unsigned c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c] {
+            std::uint64_t mine = 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                std::uint64_t stamp;
+                if (!pop(stamp)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (++mine % 64 == 0) {
+                    samples[c].push_back(now_ns() - stamp);
+                }
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> took = Clock::now() - start;
+    std::vector<std::uint64_t> all;
+    for (auto& s : samples) {
+        all.insert(all.end(), s.begin(), s.end());
+    }
+    std::sort(all.begin(), all.end());
+    Result r = {total / took.count() / 1e6, 0, 0};
+    if (!all.empty()) {
+        r.p50_us = all[all.size() / 2] / 1e3;
+        r.p99_us = all[all.size() * 99 / 100] / 1e3;
+    }
+    return r;
+}
+
+void print(const char* name, unsigned p, unsigned c, Result r) {
+    std::printf("%-22s %u:%u  %7.2f Mop/s  p50 %9.1f us  p99 %9.1f us\n",
+                name, p, c, r.mops, r.p50_us, r.p99_us);
+}
+
+int main() {
+    check_spsc();
+    check_mpmc();
+    const std::uint64_t items = 2000000;
+    const std::size_t capacity = 1024;
+    {
+        structures::SpscQueue<std::uint64_t> q(capacity);
+        print("SpscQueue", 1, 1, run(1, 1, items,
+            [&](std::uint64_t v) { return q.try_enqueue(v); },
+            [&](std::uint64_t& v) { return q.try_dequeue(v); }));
+    }
+    for (unsigned threads : {1u, 2u, 4u}) {
+        {
+            structures::MpmcQueue<std::uint64_t> q(capacity);
+            print("MpmcQueue", threads, threads, run(threads, threads,
+                items / threads,
+                [&](std::uint64_t v) { return q.try_enqueue(v); },
+                [&](std::uint64_t& v) { return q.try_dequeue(v); }));
+        }
+        {
+            structures::ArrayQueue<std::uint64_t> q(capacity);
+            std::mutex mutex;
+            print("ArrayQueue + mutex", threads, threads, run(threads,
+                threads, items / threads,
+                [&](std::uint64_t v) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (q.full()) {
+                        return false;
+                    }
+                    q.enqueue(v);
+                    return true;
+                },
+                [&](std::uint64_t& v) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (q.empty()) {
+                        return false;
+                    }
+                    v = q.dequeue();
+                    return true;
+                }));
+        }
+    }
+    return 0;
+}
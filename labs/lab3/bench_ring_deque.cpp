@@ -0,0 +1,159 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! RingDeque contra std::deque: confere as operacoes com um std::deque e
+//! mede padroes produtor/consumidor (fila em regime, rajadas que crescem
+//! e esvaziam, e uso como pilha pelas duas pontas).
+//!
+//!     g++ -std=c++17 -O2 bench_ring_deque.cpp -o bench_ring_deque
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "./ring_deque.h"
+
+void check() {
+    std::mt19937 rng(29);
+    structures::RingDeque<std::string> ring(1);
+    std::deque<std::string> mirror;
+    for (int op = 0; op < 200000; op++) {
+        int kind = rng() % 7;
+        std::string value = std::to_string(op) + std::string(op % 40, 'x');
+        if (kind == 0) {
+            ring.push_back(value);
+            mirror.push_back(value);
+        } else if (kind == 1) {
+            mirror.push_front(value);
+            ring.push_front(std::move(value));
+        } else if (kind == 2 && !mirror.empty()) {
+            assert(ring.pop_front() == mirror.front());
+            mirror.pop_front();
+        } else if (kind == 3 && !mirror.empty()) {
+            assert(ring.pop_back() == mirror.back());
+            mirror.pop_back();
+        } else if (kind == 4 && !mirror.empty()) {
+            std::size_t index = rng() % mirror.size();
+            assert(ring[index] == mirror[index]);
+            assert(ring.front() == mirror.front());
+            assert(ring.back() == mirror.back());
+        } else if (kind == 5) {
+            ring.enqueue(value);
+            mirror.push_back(value);
+        } else if (!mirror.empty()) {
+            assert(ring.dequeue() == mirror.front());
+            mirror.pop_front();
+        }
+        assert(ring.size() == mirror.size());
+        assert((ring.capacity() & (ring.capacity() - 1)) == 0);
+    }
+    // elemento que so pode ser movido
+    structures::RingDeque<std::unique_ptr<int>> owned;
+    for (int i = 0; i < 100; i++) {
+        owned.push_back(std::make_unique<int>(i));
+    }
+    for (int i = 0; i < 100; i++) {
+        assert(*owned.pop_front() == i);
+    }
+    std::printf("RingDeque: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+template<typename Deque>
+long long steady(Deque& q, std::size_t ops) {
+    long long sum = 0;
+    for (int i = 0; i < 1024; i++) {
+        q.push_back(i);
+    }
+    for (std::size_t i = 0; i < ops; i++) {
+        q.push_back(static_cast<int>(i));
+        sum += q.front();
+        q.pop_front();
+    }
+    return sum;
+}
+
+template<typename Deque>
+long long bursts(Deque& q, std::size_t ops) {
+    long long sum = 0;
+    for (std::size_t done = 0; done < ops; done += 100000) {
+        for (int i = 0; i < 100000; i++) {
+            q.push_back(i);
+        }
+        while (!q.empty()) {
+            sum += q.front();
+            q.pop_front();
+        }
+    }
+    return sum;
+}
+
+template<typename Deque>
+long long both_ends(Deque& q, std::size_t ops) {
+    long long sum = 0;
+    for (std::size_t i = 0; i < ops; i++) {
+        if (i % 3 == 0) {
+            q.push_front(static_cast<int>(i));
+        } else {
+            q.push_back(static_cast<int>(i));
+        }
+        if (i % 4 == 3) {
+            sum += q.back();
+            q.pop_back();
+            sum += q.front();
+            q.pop_front();
+        }
+    }
+    return sum;
+}
+
+// adapta RingDeque aos nomes do std::deque usados acima
+struct Ring : structures::RingDeque<int> {
+    void pop_front() {
+        structures::RingDeque<int>::pop_front();
+    }
+    void pop_back() {
+        structures::RingDeque<int>::pop_back();
+    }
+};
+
+int main() {
+    check();
+    const std::size_t ops = 20000000;
+    const char* names[] = {"fila em regime", "rajadas de 100K",
+                           "duas pontas"};
+    for (int pattern = 0; pattern < 3; pattern++) {
+        long long sums[2];
+        double took[2];
+        {
+            Ring ring;
+            took[0] = seconds([&] {
+                sums[0] = pattern == 0 ? steady(ring, ops) :
+                          pattern == 1 ? bursts(ring, ops) :
+                          both_ends(ring, ops);
+            });
+        }
+        {
+            std::deque<int> deque;
+            took[1] = seconds([&] {
+                sums[1] = pattern == 0 ? steady(deque, ops) :
+                          pattern == 1 ? bursts(deque, ops) :
+                          both_ends(deque, ops);
+            });
+        }
+        assert(sums[0] == sums[1]);
+        std::printf("%-16s RingDeque %6.1f Mop/s  std::deque %6.1f Mop/s\n",
+                    names[pattern], ops / took[0] / 1e6,
+                    ops / took[1] / 1e6);
+    }
+    return 0;
+}
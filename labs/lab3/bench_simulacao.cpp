@@ -0,0 +1,109 @@
+// Copyright [2023] <Luan da Silva Moraes>
+//! Simulacao de estacionamentos: confere invariantes (toda chegada aceita
+//! sai, determinismo pela semente, configuracao invalida rejeitada antes
+//! das threads e excecao de uma thread relancada no chamador) e mede a
+//! vazao em eventos por segundo com 1, 2, 4 e 8 threads.
+//!
+//!     g++ -std=c++17 -O2 -pthread bench_simulacao.cpp -o bench_simulacao
+//!     ./bench_simulacao [chegadas por estacionamento, padrao 200000]
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include "./simulacao_estacionamento.h"
+
+void check() {
+    parking::Config config;
+    config.vehicles = 20000;
+    config.lanes = 3;
+    config.lane_capacity = 10;
+    config.mean_stay = 40.0;
+    for (auto d : {parking::Distribution::CONSTANT,
+                   parking::Distribution::UNIFORM,
+                   parking::Distribution::EXPONENTIAL}) {
+        config.arrivals = config.stays = d;
+        parking::Stats a = parking::simulate_lot(config);
+        parking::Stats b = parking::simulate_lot(config);
+        assert(a.arrivals == config.vehicles);
+        assert(a.departures + a.rejected == a.arrivals);
+        assert(a.events == a.arrivals + a.departures);
+        assert(a.max_occupancy <= config.lanes * config.lane_capacity);
+        assert(a.departures == b.departures && a.rejected == b.rejected);
+        assert(a.occupancy_time == b.occupancy_time);
+    }
+
+    std::vector<parking::Config> configs(8, config);
+    for (std::size_t i = 0; i < configs.size(); i++) {
+        configs[i].seed = i;
+    }
+    std::vector<parking::Stats> per_lot(configs.size());
+    parking::Stats total = parking::simulate_batch(configs.data(),
+        configs.size(), 4, per_lot.data());
+    std::uint64_t events = 0;
+    for (std::size_t i = 0; i < configs.size(); i++) {
+        parking::Stats alone = parking::simulate_lot(configs[i]);
+        assert(alone.events == per_lot[i].events);
+        events += alone.events;
+    }
+    assert(total.events == events);
+
+    // configuracoes invalidas: recusadas antes de qualquer thread
+    for (double mean : {0.0, -1.0, 1.0 / 0.0}) {
+        configs[5].mean_interarrival = mean;
+        bool threw = false;
+        try {
+            parking::simulate_batch(configs.data(), configs.size(), 4);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+    configs[5].mean_interarrival = 1.0;
+    configs[5].lanes = 0;
+    bool threw = false;
+    try {
+        parking::simulate_batch(configs.data(), configs.size(), 4);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // falha dentro de uma thread: relancada depois dos joins
+    configs[5].lanes = 1;
+    configs[5].lane_capacity = SIZE_MAX / 4;  // new[] estoura o tamanho
+    threw = false;
+    try {
+        parking::simulate_batch(configs.data(), configs.size(), 4);
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+    assert(threw);
+    std::printf("simulacao: ok\n");
+}
+
+int main(int argc, char** argv) {
+    check();
+    parking::Config config;
+    config.vehicles = argc > 1 ? std::strtoull(argv[1], nullptr, 10) :
+                                 200000;
+    std::vector<parking::Config> configs(16, config);
+    for (std::size_t i = 0; i < configs.size(); i++) {
+        configs[i].seed = i + 1;
+    }
+    parking::Stats one = parking::simulate_lot(configs[0]);
+    std::printf("1 estacionamento: %.2f M eventos/s, ocupacao media %.1f, "
+                "recusados %.2f%%\n", one.events_per_second() / 1e6,
+                one.mean_occupancy(), 100.0 * one.rejected / one.arrivals);
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        parking::Stats total = parking::simulate_batch(configs.data(),
+            configs.size(), threads);
+        std::printf("%zu estacionamentos, %u threads: %.2f M eventos/s\n",
+                    configs.size(), threads,
+                    total.events_per_second() / 1e6);
+    }
+    return 0;
+}
@@ -0,0 +1,330 @@
+// Copyright [2018] <Luan da Silva Moraes>
+#ifndef STRUCTURES_BLOCKING_QUEUE_H
+#define STRUCTURES_BLOCKING_QUEUE_H
+
+#include <chrono>  // std::chrono
+#include <condition_variable>  // std::condition_variable
+#include <cstdint>  // std::size_t
+#include <mutex>  // std::mutex
+#include <stdexcept>  // C++ Exceptions
+#include <utility>  // std::move
+
+namespace structures {
+
+template<typename T>
+//! classe BlockingQueue
+/*!
+    Fila circular limitada (mesmo vetor circular da ArrayQueue) protegida
+    por um mutex, para ligar estágios de um pipeline. Em vez de lançar
+    "Fila cheia", enqueue espera até haver espaço (pressão de retorno
+    sobre o produtor); dequeue espera até haver um elemento. As variantes
+    *_for desistem depois de um tempo limite.
+
+    As variáveis de condição só são notificadas quando há alguma thread
+    esperando, o que só acontece com a fila vazia (consumidores) ou cheia
+    (produtores): no regime normal nenhuma operação faz chamada ao sistema.
+    dequeue_bulk retira vários elementos com uma única aquisição do mutex.
+*/
+class BlockingQueue {
+ public:
+    //! construtor padrao
+    BlockingQueue();
+    //! construtor com parametro
+    explicit BlockingQueue(std::size_t max);
+    //! destrutor padrao
+    ~BlockingQueue();
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+    //! metodo enfileirar; espera enquanto a fila estiver cheia
+    void enqueue(const T& data);
+    //! metodo enfileirar; false se continuar cheia apos 'timeout'
+    template<typename Rep, typename Period>
+    bool try_enqueue_for(const T& data,
+                         const std::chrono::duration<Rep, Period>& timeout);
+    //! metodo enfileira os 'n' elementos, esperando por espaco
+    std::size_t enqueue_bulk(const T* data, std::size_t n);
+    //! metodo desenfileirar; espera enquanto a fila estiver vazia
+    T dequeue();
+    //! metodo desenfileirar; false se continuar vazia apos 'timeout'
+    template<typename Rep, typename Period>
+    bool try_dequeue_for(T& data,
+                         const std::chrono::duration<Rep, Period>& timeout);
+    //! metodo espera ao menos um elemento e retira ate 'max' de uma vez
+    std::size_t dequeue_bulk(T* out, std::size_t max);
+    //! metodo fecha a fila: acorda todos; novos enqueue lancam excecao
+    void close();
+    //! metodo verifica se foi fechada
+    bool closed();
+    //! metodo retorna tamanho atual
+    std::size_t size();
+    //! metodo retorna tamanho maximo
+    std::size_t max_size();
+    //! metodo verifica se vazio
+    bool empty();
+
+ private:
+    //! insere no fim (com o mutex adquirido e espaco garantido)
+    void push(const T& data);
+    //! retira do inicio (com o mutex adquirido e fila nao vazia)
+    T pop();
+    //! acorda quem espera por elementos, se houver alguem
+    void notify_consumers(std::size_t added);
+    //! acorda quem espera por espaco, se houver alguem
+    void notify_producers(std::size_t removed);
+
+    T* contents;
+    std::size_t size_;
+    std::size_t max_size_;
+    std::size_t begin_;  // indice do inicio (para fila circular)
+    std::size_t end_;  // indice da proxima posicao livre
+    bool closed_;
+
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::size_t waiting_consumers_;
+    std::size_t waiting_producers_;
+
+    static const auto DEFAULT_SIZE = 1024u;
+};
+
+}  // namespace structures
+
+//! construtor padrao
+template<typename T>
+structures::BlockingQueue<T>::BlockingQueue():
+    BlockingQueue(DEFAULT_SIZE)
+{}
+
+//! construtor com parametro
+template<typename T>
+structures::BlockingQueue<T>::BlockingQueue(std::size_t max) {
+    if (max == 0) {
+        throw std::out_of_range("Tamanho invalido");
+    }
+    max_size_ = max;
+    contents = new T[max_size_];
+    begin_ = 0;
+    end_ = 0;
+    size_ = 0;
+    closed_ = false;
+    waiting_consumers_ = 0;
+    waiting_producers_ = 0;
+}
+
+//! destrutor padrao
+template<typename T>
+structures::BlockingQueue<T>::~BlockingQueue() {
+    delete [] contents;
+}
+
+template<typename T>
+void structures::BlockingQueue<T>::push(const T& data) {
+    contents[end_] = data;
+    if (++end_ == max_size_) {
+        end_ = 0;
+    }
+    size_++;
+}
+
+template<typename T>
+T structures::BlockingQueue<T>::pop() {
+    T data = std::move(contents[begin_]);
+    if (++begin_ == max_size_) {
+        begin_ = 0;
+    }
+    size_--;
+    return data;
+}
+
+template<typename T>
+void structures::BlockingQueue<T>::notify_consumers(std::size_t added) {
+    if (waiting_consumers_ == 0) {
+        return;
+    }
+    if (added > 1) {
+        not_empty_.notify_all();
+    } else {
+        not_empty_.notify_one();
+    }
+}
+
+template<typename T>
+void structures::BlockingQueue<T>::notify_producers(std::size_t removed) {
+    if (waiting_producers_ == 0) {
+        return;
+    }
+    if (removed > 1) {
+        not_full_.notify_all();
+    } else {
+        not_full_.notify_one();
+    }
+}
+
+//! metodo enfileirar
+template<typename T>
+void structures::BlockingQueue<T>::enqueue(const T& data) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_producers_++;
+    not_full_.wait(lock, [this] { return closed_ || size_ < max_size_; });
+    waiting_producers_--;
+    if (closed_) {
+        throw std::out_of_range("Fila fechada");
+    }
+
+    push(data);
+    notify_consumers(1);
+}
+
+//! metodo enfileirar com tempo limite
+template<typename T>
+template<typename Rep, typename Period>
+bool structures::BlockingQueue<T>::try_enqueue_for(
+        const T& data, const std::chrono::duration<Rep, Period>& timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_producers_++;
+    bool ready = not_full_.wait_for(lock, timeout, [this] {
+        return closed_ || size_ < max_size_;
+    });
+    waiting_producers_--;
+    if (closed_) {
+        throw std::out_of_range("Fila fechada");
+    }
+    if (!ready) {
+        return false;
+    }
+
+    push(data);
+    notify_consumers(1);
+    return true;
+}
+
+//! metodo enfileira todos os elementos, em lotes conforme houver espaco
+/*!
+    Retorna quantos elementos entraram: n, a menos que a fila seja
+    fechada no meio, quando data[0, retorno) já foram entregues aos
+    consumidores e data[retorno, n) não. Lança "Fila fechada" só se
+    nenhum elemento entrou.
+*/
+template<typename T>
+std::size_t structures::BlockingQueue<T>::enqueue_bulk(const T* data,
+                                                       std::size_t n) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::size_t done = 0;
+    while (done < n) {
+        waiting_producers_++;
+        not_full_.wait(lock, [this] { return closed_ || size_ < max_size_; });
+        waiting_producers_--;
+        if (closed_) {
+            if (done == 0) {
+                throw std::out_of_range("Fila fechada");
+            }
+            return done;
+        }
+
+        std::size_t batch = 0;
+        while (done < n && size_ < max_size_) {
+            push(data[done++]);
+            batch++;
+        }
+        notify_consumers(batch);
+    }
+    return done;
+}
+
+//! metodo desenfileirar
+template<typename T>
+T structures::BlockingQueue<T>::dequeue() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_consumers_++;
+    not_empty_.wait(lock, [this] { return closed_ || size_ > 0; });
+    waiting_consumers_--;
+    if (size_ == 0) {  // fechada e sem elementos
+        throw std::out_of_range("Fila vazia");
+    }
+
+    T data = pop();
+    notify_producers(1);
+    return data;
+}
+
+//! metodo desenfileirar com tempo limite
+template<typename T>
+template<typename Rep, typename Period>
+bool structures::BlockingQueue<T>::try_dequeue_for(
+        T& data, const std::chrono::duration<Rep, Period>& timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_consumers_++;
+    not_empty_.wait_for(lock, timeout, [this] {
+        return closed_ || size_ > 0;
+    });
+    waiting_consumers_--;
+    if (size_ == 0) {
+        return false;
+    }
+
+    data = pop();
+    notify_producers(1);
+    return true;
+}
+
+//! metodo retira ate 'max' elementos com uma unica aquisicao do mutex
+/*!
+    Retorna 0 apenas se a fila foi fechada e já está vazia.
+*/
+template<typename T>
+std::size_t structures::BlockingQueue<T>::dequeue_bulk(T* out,
+                                                       std::size_t max) {
+    if (max == 0) {
+        return 0;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_consumers_++;
+    not_empty_.wait(lock, [this] { return closed_ || size_ > 0; });
+    waiting_consumers_--;
+
+    std::size_t n = 0;
+    while (n < max && size_ > 0) {
+        out[n++] = pop();
+    }
+    notify_producers(n);
+    return n;
+}
+
+//! metodo fecha a fila
+template<typename T>
+void structures::BlockingQueue<T>::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+    not_full_.notify_all();
+}
+
+//! metodo verifica se foi fechada
+template<typename T>
+bool structures::BlockingQueue<T>::closed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+}
+
+//! metodo retorna tamanho atual
+template<typename T>
+std::size_t structures::BlockingQueue<T>::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+//! metodo retorna tamanho maximo
+template<typename T>
+std::size_t structures::BlockingQueue<T>::max_size() {
+    return max_size_;
+}
+
+//! metodo verifica se vazio
+template<typename T>
+bool structures::BlockingQueue<T>::empty() {
+    return size() == 0;
+}
+
+#endif
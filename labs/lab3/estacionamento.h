@@ -10,18 +10,16 @@
 
 
 void retira_veiculo(structures::ArrayQueue<int> *f, int k) {
-    for (int i = 0; i < k - 1; i++) {
-        f->enqueue(f->dequeue());
+    // equivale a k - 1 vezes enqueue(dequeue()), sem mover um a um
+    if (k > 1) {
+        f->rotate(k - 1);
     }
     f->dequeue();
 }
 
 
 void mantenha_veiculo(structures::ArrayQueue<int> *f, int k) {
-    int kElement;
-    for (int i = 0; i < k; i++) {
-        kElement = f->dequeue();
-    }
+    int kElement = f->at(k - 1);
 
     f->clear();
     f->enqueue(kElement);
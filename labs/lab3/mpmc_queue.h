@@ -0,0 +1,219 @@
+// Copyright [2018] <Luan da Silva Moraes>
+#ifndef STRUCTURES_MPMC_QUEUE_H
+#define STRUCTURES_MPMC_QUEUE_H
+
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::size_t, std::intptr_t
+#include <stdexcept>  // C++ Exceptions
+#include <utility>  // std::move
+
+namespace structures {
+
+template<typename T>
+//! classe MpmcQueue
+/*!
+    Fila circular limitada, sem travas, para várias threads produtoras e
+    consumidoras. Cada posição do vetor tem um número de sequência que diz
+    se ela está livre para a volta atual do produtor ou pronta para a do
+    consumidor; as threads disputam apenas o índice de escrita (ou de
+    leitura) com compare-exchange.
+
+    A capacidade é arredondada para uma potência de dois (mínimo 2).
+*/
+class MpmcQueue {
+ public:
+    //! construtor padrao
+    MpmcQueue();
+    //! construtor com parametro
+    explicit MpmcQueue(std::size_t max);
+    //! destrutor padrao
+    ~MpmcQueue();
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+    //! metodo enfileirar; lanca se cheia
+    void enqueue(const T& data);
+    //! metodo desenfileirar; lanca se vazia
+    T dequeue();
+    //! metodo tenta enfileirar; false se cheia
+    bool try_enqueue(const T& data);
+    //! metodo tenta desenfileirar; false se vazia
+    bool try_dequeue(T& data);
+    //! metodo enfileira ate 'n' elementos; retorna quantos entraram
+    std::size_t try_enqueue_bulk(const T* data, std::size_t n);
+    //! metodo desenfileira ate 'n' elementos; retorna quantos sairam
+    std::size_t try_dequeue_bulk(T* data, std::size_t n);
+    //! metodo retorna tamanho atual (aproximado se houver concorrencia)
+    std::size_t size() const;
+    //! metodo retorna tamanho maximo
+    std::size_t max_size() const;
+    //! metodo verifica se vazio
+    bool empty() const;
+
+ private:
+    static const std::size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    Cell* cells;
+    std::size_t mask_;  // capacidade - 1
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> enqueue_pos_;
+    alignas(CACHE_LINE) std::atomic<std::size_t> dequeue_pos_;
+
+    static const auto DEFAULT_SIZE = 1024u;
+};
+
+}  // namespace structures
+
+//! construtor padrao
+template<typename T>
+structures::MpmcQueue<T>::MpmcQueue():
+    MpmcQueue(DEFAULT_SIZE)
+{}
+
+//! construtor com parametro
+template<typename T>
+structures::MpmcQueue<T>::MpmcQueue(std::size_t max) {
+    std::size_t capacity = 2;
+    while (capacity < max) {
+        capacity <<= 1;
+    }
+    cells = new Cell[capacity];
+    for (std::size_t i = 0; i < capacity; i++) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    mask_ = capacity - 1;
+    enqueue_pos_.store(0, std::memory_order_relaxed);
+    dequeue_pos_.store(0, std::memory_order_relaxed);
+}
+
+//! destrutor padrao
+template<typename T>
+structures::MpmcQueue<T>::~MpmcQueue() {
+    delete [] cells;
+}
+
+//! metodo enfileirar
+template<typename T>
+void structures::MpmcQueue<T>::enqueue(const T& data) {
+    if (!try_enqueue(data)) {
+        throw std::out_of_range("Fila cheia");
+    }
+}
+
+//! metodo desenfileirar
+template<typename T>
+T structures::MpmcQueue<T>::dequeue() {
+    T data;
+    if (!try_dequeue(data)) {
+        throw std::out_of_range("Fila vazia");
+    }
+    return data;
+}
+
+//! metodo tenta enfileirar
+template<typename T>
+bool structures::MpmcQueue<T>::try_enqueue(const T& data) {
+    Cell* cell;
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        cell = &cells[pos & mask_];
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) -
+                             static_cast<std::intptr_t>(pos);
+        if (diff == 0) {  // posicao livre nesta volta: tenta reserva-la
+            if (enqueue_pos_.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {  // ainda nao consumida na volta anterior
+            return false;
+        } else {  // outro produtor ja reservou; recarrega
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->data = data;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+//! metodo tenta desenfileirar
+template<typename T>
+bool structures::MpmcQueue<T>::try_dequeue(T& data) {
+    Cell* cell;
+    std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        cell = &cells[pos & mask_];
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) -
+                             static_cast<std::intptr_t>(pos + 1);
+        if (diff == 0) {  // posicao pronta: tenta reserva-la
+            if (dequeue_pos_.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {  // produtor ainda nao escreveu
+            return false;
+        } else {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    data = std::move(cell->data);
+    // libera a posicao para a proxima volta do produtor
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+}
+
+//! metodo enfileira ate 'n' elementos
+/*!
+    Cada elemento ainda é reservado individualmente: uma faixa contígua só
+    poderia ser reservada de uma vez esperando que todas as suas posições
+    fossem liberadas, o que bloquearia os outros produtores.
+*/
+template<typename T>
+std::size_t structures::MpmcQueue<T>::try_enqueue_bulk(const T* data,
+                                                       std::size_t n) {
+    std::size_t i = 0;
+    while (i < n && try_enqueue(data[i])) {
+        i++;
+    }
+    return i;
+}
+
+//! metodo desenfileira ate 'n' elementos
+template<typename T>
+std::size_t structures::MpmcQueue<T>::try_dequeue_bulk(T* data,
+                                                       std::size_t n) {
+    std::size_t i = 0;
+    while (i < n && try_dequeue(data[i])) {
+        i++;
+    }
+    return i;
+}
+
+//! metodo retorna tamanho atual
+template<typename T>
+std::size_t structures::MpmcQueue<T>::size() const {
+    std::size_t dequeued = dequeue_pos_.load(std::memory_order_acquire);
+    std::size_t enqueued = enqueue_pos_.load(std::memory_order_acquire);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+//! metodo retorna tamanho maximo
+template<typename T>
+std::size_t structures::MpmcQueue<T>::max_size() const {
+    return mask_ + 1;
+}
+
+//! metodo verifica se vazio
+template<typename T>
+bool structures::MpmcQueue<T>::empty() const {
+    return size() == 0;
+}
+
+#endif
@@ -0,0 +1,290 @@
+// Copyright [2018] <Luan da Silva Moraes>
+#ifndef STRUCTURES_RING_DEQUE_H
+#define STRUCTURES_RING_DEQUE_H
+
+#include <cstdint>  // std::size_t
+#include <new>  // placement new
+#include <stdexcept>  // C++ Exceptions
+#include <utility>  // std::move
+
+namespace structures {
+
+template<typename T>
+//! classe RingDeque
+/*!
+    Fila dupla circular que cresce sob demanda. Diferente da ArrayQueue, a
+    capacidade é sempre uma potência de dois (o índice é ajustado com uma
+    máscara em vez de '%'), apenas as posições ocupadas têm objetos
+    construídos e a remoção move o elemento para fora do vetor.
+*/
+class RingDeque {
+ public:
+    //! construtor padrao
+    RingDeque();
+    //! construtor com capacidade inicial (arredondada para potencia de 2)
+    explicit RingDeque(std::size_t capacity);
+    //! destrutor padrao
+    ~RingDeque();
+    RingDeque(const RingDeque&) = delete;
+    RingDeque& operator=(const RingDeque&) = delete;
+    //! metodo insere no fim
+    void push_back(const T& data);
+    //! metodo insere no fim (movendo)
+    void push_back(T&& data);
+    //! metodo insere no inicio
+    void push_front(const T& data);
+    //! metodo insere no inicio (movendo)
+    void push_front(T&& data);
+    //! metodo retira do inicio
+    T pop_front();
+    //! metodo retira do fim
+    T pop_back();
+    //! metodo enfileirar (igual a push_back)
+    void enqueue(const T& data);
+    //! metodo desenfileirar (igual a pop_front)
+    T dequeue();
+    //! metodo retorna o primeiro
+    T& front();
+    //! metodo retorna o ultimo
+    T& back();
+    //! metodo acesso por posicao (0 e o inicio), sem verificacao
+    T& operator[](std::size_t index);
+    //! metodo acesso por posicao (0 e o inicio), sem verificacao
+    const T& operator[](std::size_t index) const;
+    //! metodo acesso por posicao com verificacao
+    T& at(std::size_t index);
+    //! metodo limpa a fila
+    void clear();
+    //! metodo garante espaco para 'capacity' elementos
+    void reserve(std::size_t capacity);
+    //! metodo retorna tamanho atual
+    std::size_t size() const;
+    //! metodo retorna capacidade atual
+    std::size_t capacity() const;
+    //! metodo verifica se vazio
+    bool empty() const;
+
+ private:
+    //! endereco da posicao 'index' a partir do inicio
+    T* slot(std::size_t index) const {
+        return contents + ((begin_ + index) & mask_);
+    }
+    //! realoca para 'capacity' (potencia de 2) mantendo a ordem
+    void reallocate(std::size_t capacity);
+
+    T* contents;
+    std::size_t begin_;  // indice do inicio
+    std::size_t size_;
+    std::size_t mask_;  // capacidade - 1
+    static const auto DEFAULT_SIZE = 16u;
+};
+
+}  // namespace structures
+
+//! construtor padrao
+template<typename T>
+structures::RingDeque<T>::RingDeque():
+    RingDeque(DEFAULT_SIZE)
+{}
+
+//! construtor com capacidade inicial
+template<typename T>
+structures::RingDeque<T>::RingDeque(std::size_t capacity) {
+    std::size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    contents = static_cast<T*>(::operator new(rounded * sizeof(T)));
+    begin_ = 0;
+    size_ = 0;
+    mask_ = rounded - 1;
+}
+
+//! destrutor padrao
+template<typename T>
+structures::RingDeque<T>::~RingDeque() {
+    clear();
+    ::operator delete(contents);
+}
+
+//! realoca mantendo a ordem (o inicio vai para o indice 0)
+template<typename T>
+void structures::RingDeque<T>::reallocate(std::size_t capacity) {
+    T* bigger = static_cast<T*>(::operator new(capacity * sizeof(T)));
+    for (std::size_t i = 0; i < size_; i++) {
+        T* old = slot(i);
+        new (bigger + i) T(std::move(*old));
+        old->~T();
+    }
+    ::operator delete(contents);
+    contents = bigger;
+    begin_ = 0;
+    mask_ = capacity - 1;
+}
+
+//! metodo garante espaco para 'capacity' elementos
+template<typename T>
+void structures::RingDeque<T>::reserve(std::size_t capacity) {
+    std::size_t rounded = mask_ + 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    if (rounded != mask_ + 1) {
+        reallocate(rounded);
+    }
+}
+
+//! metodo insere no fim
+template<typename T>
+void structures::RingDeque<T>::push_back(const T& data) {
+    push_back(T(data));  // copia antes: 'data' pode estar no vetor
+}
+
+//! metodo insere no fim (movendo)
+template<typename T>
+void structures::RingDeque<T>::push_back(T&& data) {
+    if (size_ == capacity()) {
+        T moved(std::move(data));
+        reallocate(2 * capacity());
+        new (slot(size_)) T(std::move(moved));
+    } else {
+        new (slot(size_)) T(std::move(data));
+    }
+    size_++;
+}
+
+//! metodo insere no inicio
+template<typename T>
+void structures::RingDeque<T>::push_front(const T& data) {
+    push_front(T(data));
+}
+
+//! metodo insere no inicio (movendo)
+template<typename T>
+void structures::RingDeque<T>::push_front(T&& data) {
+    if (size_ == capacity()) {
+        T moved(std::move(data));
+        reallocate(2 * capacity());
+        begin_ = (begin_ - 1) & mask_;
+        new (contents + begin_) T(std::move(moved));
+    } else {
+        begin_ = (begin_ - 1) & mask_;
+        new (contents + begin_) T(std::move(data));
+    }
+    size_++;
+}
+
+//! metodo retira do inicio
+template<typename T>
+T structures::RingDeque<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("Fila vazia");
+    }
+
+    T* first = contents + begin_;
+    T data = std::move(*first);
+    first->~T();
+    begin_ = (begin_ + 1) & mask_;
+    size_--;
+
+    return data;
+}
+
+//! metodo retira do fim
+template<typename T>
+T structures::RingDeque<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("Fila vazia");
+    }
+
+    T* last = slot(size_ - 1);
+    T data = std::move(*last);
+    last->~T();
+    size_--;
+
+    return data;
+}
+
+//! metodo enfileirar
+template<typename T>
+void structures::RingDeque<T>::enqueue(const T& data) {
+    push_back(data);
+}
+
+//! metodo desenfileirar
+template<typename T>
+T structures::RingDeque<T>::dequeue() {
+    return pop_front();
+}
+
+//! metodo retorna o primeiro
+template<typename T>
+T& structures::RingDeque<T>::front() {
+    if (empty()) {
+        throw std::out_of_range("Fila vazia");
+    }
+
+    return contents[begin_];
+}
+
+//! metodo retorna o ultimo
+template<typename T>
+T& structures::RingDeque<T>::back() {
+    if (empty()) {
+        throw std::out_of_range("Fila vazia");
+    }
+
+    return *slot(size_ - 1);
+}
+
+//! metodo acesso por posicao, sem verificacao
+template<typename T>
+T& structures::RingDeque<T>::operator[](std::size_t index) {
+    return *slot(index);
+}
+
+//! metodo acesso por posicao, sem verificacao
+template<typename T>
+const T& structures::RingDeque<T>::operator[](std::size_t index) const {
+    return *slot(index);
+}
+
+//! metodo acesso por posicao com verificacao
+template<typename T>
+T& structures::RingDeque<T>::at(std::size_t index) {
+    if (index >= size_) {
+        throw std::out_of_range("Posicao invalida");
+    }
+
+    return *slot(index);
+}
+
+//! metodo limpa a fila
+template<typename T>
+void structures::RingDeque<T>::clear() {
+    for (std::size_t i = 0; i < size_; i++) {
+        slot(i)->~T();
+    }
+    begin_ = 0;
+    size_ = 0;
+}
+
+//! metodo retorna tamanho atual
+template<typename T>
+std::size_t structures::RingDeque<T>::size() const {
+    return size_;
+}
+
+//! metodo retorna capacidade atual
+template<typename T>
+std::size_t structures::RingDeque<T>::capacity() const {
+    return mask_ + 1;
+}
+
+//! metodo verifica se vazio
+template<typename T>
+bool structures::RingDeque<T>::empty() const {
+    return size_ == 0;
+}
+
+#endif
@@ -0,0 +1,278 @@
+// Copyright [2023] <Luan da Silva Moraes>
+#ifndef PARKING_SIMULATION_H
+#define PARKING_SIMULATION_H
+
+#include <algorithm>  // std::max
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono
+#include <cmath>  // std::isfinite
+#include <cstdint>  // std::uint64_t
+#include <exception>  // std::exception_ptr
+#include <memory>  // std::unique_ptr
+#include <mutex>  // std::mutex
+#include <queue>  // std::priority_queue
+#include <random>  // std::mt19937_64, distribuicoes
+#include <stdexcept>  // C++ Exceptions
+#include <system_error>  // std::system_error
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include "./array_queue.cpp"
+
+/*
+    Simulação de estacionamentos por eventos discretos.
+
+    Cada estacionamento tem várias filas (ArrayQueue<std::uint64_t> com a
+    capacidade da fila) e uma fila de prioridade de eventos ordenada pelo
+    instante. Uma chegada ocupa a fila com mais vagas (ou é recusada se
+    todas estiverem cheias) e agenda a sua saída; uma saída retira o
+    veículo da sua fila mantendo a ordem dos demais, como
+    'retira_veiculo'.
+
+    Estacionamentos são independentes: 'simulate_batch' distribui vários
+    deles entre threads e soma as estatísticas. Uma exceção lançada em
+    qualquer thread é relançada por 'simulate_batch' depois dos joins.
+*/
+
+namespace parking {
+
+//! distribuicao dos intervalos entre chegadas e das permanencias
+enum class Distribution {
+    CONSTANT,  // sempre a media
+    UNIFORM,  // uniforme em [0, 2 * media]
+    EXPONENTIAL  // processo de Poisson
+};
+
+//! parametros de um estacionamento
+struct Config {
+    std::size_t lanes = 4;
+    std::size_t lane_capacity = 50;
+    Distribution arrivals = Distribution::EXPONENTIAL;
+    double mean_interarrival = 1.0;
+    Distribution stays = Distribution::EXPONENTIAL;
+    double mean_stay = 150.0;
+    std::uint64_t vehicles = 1000000;  // chegadas simuladas
+    std::uint64_t seed = 1;
+};
+
+//! estatisticas de uma ou mais simulacoes
+struct Stats {
+    std::uint64_t events = 0;
+    std::uint64_t arrivals = 0;
+    std::uint64_t departures = 0;
+    std::uint64_t rejected = 0;  // chegadas com todas as filas cheias
+    double occupancy_time = 0.0;  // integral da ocupacao no tempo
+    double simulated_time = 0.0;
+    std::size_t max_occupancy = 0;
+    double wall_seconds = 0.0;
+
+    //! ocupacao media ponderada pelo tempo
+    double mean_occupancy() const {
+        return simulated_time > 0 ? occupancy_time / simulated_time : 0.0;
+    }
+    //! eventos processados por segundo de relogio
+    double events_per_second() const {
+        return wall_seconds > 0 ? events / wall_seconds : 0.0;
+    }
+    //! acumula outra simulacao (o tempo de relogio nao e somado)
+    void add(const Stats& other) {
+        events += other.events;
+        arrivals += other.arrivals;
+        departures += other.departures;
+        rejected += other.rejected;
+        occupancy_time += other.occupancy_time;
+        simulated_time += other.simulated_time;
+        max_occupancy = std::max(max_occupancy, other.max_occupancy);
+    }
+};
+
+//! sorteia um intervalo com a distribuicao e a media dadas
+inline double draw(Distribution distribution, double mean,
+                   std::mt19937_64& generator) {
+    switch (distribution) {
+    case Distribution::CONSTANT:
+        return mean;
+    case Distribution::UNIFORM:
+        return std::uniform_real_distribution<double>(0.0, 2 * mean)(
+            generator);
+    case Distribution::EXPONENTIAL:
+    default:
+        return std::exponential_distribution<double>(1.0 / mean)(generator);
+    }
+}
+
+//! verifica se 'mean' serve de media para 'distribution'
+inline bool valid_mean(Distribution distribution, double mean) {
+    if (!std::isfinite(mean)) {
+        return false;
+    }
+    // uniforme e exponencial precisam de media positiva
+    return distribution == Distribution::CONSTANT ? mean >= 0 : mean > 0;
+}
+
+//! lanca std::out_of_range se a configuracao nao puder ser simulada
+inline void validate(const Config& config) {
+    if (config.lanes == 0 || config.lane_capacity == 0) {
+        throw std::out_of_range("Estacionamento sem vagas");
+    }
+    if (!valid_mean(config.arrivals, config.mean_interarrival) ||
+        !valid_mean(config.stays, config.mean_stay)) {
+        throw std::out_of_range("Media invalida");
+    }
+}
+
+//! simula um estacionamento ate esgotar as chegadas e as saidas
+inline Stats simulate_lot(const Config& config) {
+    validate(config);
+
+    struct Event {
+        double time;
+        std::uint64_t sequence;  // desempate estavel
+        bool arrival;
+        std::uint64_t vehicle;  // so vale para saidas
+        std::size_t lane;
+    };
+    struct Later {
+        bool operator()(const Event& a, const Event& b) const {
+            return a.time > b.time ||
+                   (a.time == b.time && a.sequence > b.sequence);
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::mt19937_64 generator(config.seed);
+    std::vector<std::unique_ptr<structures::ArrayQueue<std::uint64_t>>> lanes;
+    for (std::size_t i = 0; i < config.lanes; i++) {
+        lanes.emplace_back(new structures::ArrayQueue<std::uint64_t>(
+            config.lane_capacity));
+    }
+    std::priority_queue<Event, std::vector<Event>, Later> events;
+    std::uint64_t sequence = 0;
+    std::size_t occupancy = 0;
+    double now = 0.0;
+    std::uint64_t next_vehicle = 0;
+    Stats stats;
+
+    if (config.vehicles > 0) {
+        events.push({draw(config.arrivals, config.mean_interarrival,
+                          generator), sequence++, true, 0, 0});
+    }
+
+    while (!events.empty()) {
+        Event event = events.top();
+        events.pop();
+        stats.occupancy_time += occupancy * (event.time - now);
+        now = event.time;
+        stats.events++;
+
+        if (event.arrival) {  // chegada
+            stats.arrivals++;
+            std::size_t best = 0;
+            for (std::size_t i = 1; i < lanes.size(); i++) {
+                if (lanes[i]->size() < lanes[best]->size()) {
+                    best = i;
+                }
+            }
+            if (lanes[best]->full()) {
+                stats.rejected++;
+            } else {
+                std::uint64_t vehicle = next_vehicle++;
+                lanes[best]->enqueue(vehicle);
+                occupancy++;
+                stats.max_occupancy = std::max(stats.max_occupancy,
+                                               occupancy);
+                events.push({now + draw(config.stays, config.mean_stay,
+                                        generator),
+                             sequence++, false, vehicle, best});
+            }
+            if (stats.arrivals < config.vehicles) {
+                events.push({now + draw(config.arrivals,
+                                        config.mean_interarrival, generator),
+                             sequence++, true, 0, 0});
+            }
+        } else {  // saida
+            auto& lane = lanes[event.lane];
+            std::size_t position = 0;
+            while (lane->at(position) != event.vehicle) {
+                position++;
+            }
+            lane->erase_at(position);
+            occupancy--;
+            stats.departures++;
+        }
+    }
+
+    stats.simulated_time = now;
+    stats.wall_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+//! simula 'count' estacionamentos independentes em 'threads' threads
+/*!
+    Se 'per_lot' não for nulo, recebe as estatísticas de cada um. O total
+    retornado usa o tempo de relógio do lote inteiro, então
+    events_per_second() mede a vazão agregada.
+*/
+inline Stats simulate_batch(const Config* configs, std::size_t count,
+                            unsigned threads, Stats* per_lot = nullptr) {
+    for (std::size_t i = 0; i < count; i++) {  // antes de criar threads
+        validate(configs[i]);
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (threads > count) {
+        threads = count > 0 ? static_cast<unsigned>(count) : 1u;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Stats> results(count);
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto worker = [&] {
+        try {
+            for (std::size_t i = next++; i < count; i = next++) {
+                results[i] = simulate_lot(configs[i]);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            next = count;  // as outras threads param no proximo pedido
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; t++) {
+        try {
+            pool.emplace_back(worker);
+        } catch (const std::system_error&) {
+            break;  // segue com as threads ja criadas
+        }
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    Stats total;
+    for (std::size_t i = 0; i < count; i++) {
+        total.add(results[i]);
+        if (per_lot != nullptr) {
+            per_lot[i] = results[i];
+        }
+    }
+    total.wall_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return total;
+}
+
+}  // namespace parking
+
+#endif
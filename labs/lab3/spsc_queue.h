@@ -0,0 +1,200 @@
+// Copyright [2018] <Luan da Silva Moraes>
+#ifndef STRUCTURES_SPSC_QUEUE_H
+#define STRUCTURES_SPSC_QUEUE_H
+
+#include <atomic>  // std::atomic
+#include <cstdint>  // std::size_t
+#include <stdexcept>  // C++ Exceptions
+#include <utility>  // std::move
+
+namespace structures {
+
+template<typename T>
+//! classe SpscQueue
+/*!
+    Fila circular limitada, sem travas, para exatamente uma thread
+    produtora e uma thread consumidora. Mantém a semântica da ArrayQueue
+    (enqueue lança "Fila cheia", dequeue lança "Fila vazia") e acrescenta
+    variantes try_* que retornam false em vez de lançar.
+
+    Os índices de leitura e escrita ficam em linhas de cache separadas;
+    cada lado guarda uma cópia do índice do outro lado e só relê o atômico
+    quando a cópia indica fila cheia (produtor) ou vazia (consumidor).
+*/
+class SpscQueue {
+ public:
+    //! construtor padrao
+    SpscQueue();
+    //! construtor com parametro
+    explicit SpscQueue(std::size_t max);
+    //! destrutor padrao
+    ~SpscQueue();
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    //! metodo enfileirar (somente a thread produtora)
+    void enqueue(const T& data);
+    //! metodo desenfileirar (somente a thread consumidora)
+    T dequeue();
+    //! metodo tenta enfileirar; false se cheia
+    bool try_enqueue(const T& data);
+    //! metodo tenta desenfileirar; false se vazia
+    bool try_dequeue(T& data);
+    //! metodo enfileira ate 'n' elementos; retorna quantos entraram
+    std::size_t try_enqueue_bulk(const T* data, std::size_t n);
+    //! metodo desenfileira ate 'n' elementos; retorna quantos sairam
+    std::size_t try_dequeue_bulk(T* data, std::size_t n);
+    //! metodo retorna tamanho atual (aproximado se houver concorrencia)
+    std::size_t size() const;
+    //! metodo retorna tamanho maximo
+    std::size_t max_size() const;
+    //! metodo verifica se vazio
+    bool empty() const;
+    //! metodo verifica se esta cheio
+    bool full() const;
+
+ private:
+    static const std::size_t CACHE_LINE = 64;
+
+    T* contents;
+    std::size_t mask_;  // capacidade do vetor (potencia de 2) - 1
+    std::size_t max_size_;
+
+    //! lado consumidor: proximo a ler e copia do indice do produtor
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_;
+    std::size_t cached_tail_;
+    //! lado produtor: proximo a escrever e copia do indice do consumidor
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_;
+    std::size_t cached_head_;
+
+    static const auto DEFAULT_SIZE = 1024u;
+};
+
+}  // namespace structures
+
+//! construtor padrao
+template<typename T>
+structures::SpscQueue<T>::SpscQueue():
+    SpscQueue(DEFAULT_SIZE)
+{}
+
+//! construtor com parametro
+template<typename T>
+structures::SpscQueue<T>::SpscQueue(std::size_t max) {
+    std::size_t capacity = 1;
+    while (capacity < max) {
+        capacity <<= 1;
+    }
+    contents = new T[capacity];
+    mask_ = capacity - 1;
+    max_size_ = max;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    cached_head_ = 0;
+    cached_tail_ = 0;
+}
+
+//! destrutor padrao
+template<typename T>
+structures::SpscQueue<T>::~SpscQueue() {
+    delete [] contents;
+}
+
+//! metodo enfileirar
+template<typename T>
+void structures::SpscQueue<T>::enqueue(const T& data) {
+    if (!try_enqueue(data)) {
+        throw std::out_of_range("Fila cheia");
+    }
+}
+
+//! metodo desenfileirar
+template<typename T>
+T structures::SpscQueue<T>::dequeue() {
+    T data;
+    if (!try_dequeue(data)) {
+        throw std::out_of_range("Fila vazia");
+    }
+    return data;
+}
+
+//! metodo tenta enfileirar
+template<typename T>
+bool structures::SpscQueue<T>::try_enqueue(const T& data) {
+    return try_enqueue_bulk(&data, 1) == 1;
+}
+
+//! metodo tenta desenfileirar
+template<typename T>
+bool structures::SpscQueue<T>::try_dequeue(T& data) {
+    return try_dequeue_bulk(&data, 1) == 1;
+}
+
+//! metodo enfileira ate 'n' elementos com uma unica publicacao
+template<typename T>
+std::size_t structures::SpscQueue<T>::try_enqueue_bulk(const T* data,
+                                                       std::size_t n) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    std::size_t free_slots = max_size_ - (tail - cached_head_);
+    if (free_slots < n) {
+        cached_head_ = head_.load(std::memory_order_acquire);
+        free_slots = max_size_ - (tail - cached_head_);
+    }
+    if (n > free_slots) {
+        n = free_slots;
+    }
+
+    for (std::size_t i = 0; i < n; i++) {
+        contents[(tail + i) & mask_] = data[i];
+    }
+    tail_.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+//! metodo desenfileira ate 'n' elementos com uma unica publicacao
+template<typename T>
+std::size_t structures::SpscQueue<T>::try_dequeue_bulk(T* data,
+                                                       std::size_t n) {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t available = cached_tail_ - head;
+    if (available < n) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        available = cached_tail_ - head;
+    }
+    if (n > available) {
+        n = available;
+    }
+
+    for (std::size_t i = 0; i < n; i++) {
+        data[i] = std::move(contents[(head + i) & mask_]);
+    }
+    head_.store(head + n, std::memory_order_release);
+    return n;
+}
+
+//! metodo retorna tamanho atual
+template<typename T>
+std::size_t structures::SpscQueue<T>::size() const {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+//! metodo retorna tamanho maximo
+template<typename T>
+std::size_t structures::SpscQueue<T>::max_size() const {
+    return max_size_;
+}
+
+//! metodo verifica se vazio
+template<typename T>
+bool structures::SpscQueue<T>::empty() const {
+    return size() == 0;
+}
+
+//! metodo verifica se esta cheio
+template<typename T>
+bool structures::SpscQueue<T>::full() const {
+    return size() >= max_size_;
+}
+
+#endif
@@ -0,0 +1,85 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! Acesso por posicao com o "dedo" (ultimo no visitado) de LinkedList e
+//! DoublyCircularList: confere insert/pop/at contra um std::vector e mede
+//! o tempo por acesso com indices sequenciais, com passo e aleatorios.
+//!
+//!     g++ -std=c++17 -O2 bench_finger_cache.cpp -o bench_finger_cache
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "./linked_list.h"
+#include "../lab7/doubly_circular_list.h"
+
+template<typename List>
+void check(const char* name) {
+    std::mt19937 rng(26);
+    List list;
+    std::vector<int> mirror;
+    for (int op = 0; op < 20000; op++) {
+        std::size_t size = mirror.size();
+        int kind = rng() % 6;
+        if (kind < 2 || size == 0) {
+            std::size_t index = rng() % (size + 1);
+            int value = static_cast<int>(rng());
+            list.insert(value, index);
+            mirror.insert(mirror.begin() + index, value);
+        } else if (kind == 2) {
+            std::size_t index = rng() % size;
+            assert(list.pop(index) == mirror[index]);
+            mirror.erase(mirror.begin() + index);
+        } else if (kind == 3) {
+            list.push_front(op);
+            mirror.insert(mirror.begin(), op);
+        } else {
+            std::size_t index = rng() % size;
+            assert(list.at(index) == mirror[index]);
+        }
+        assert(list.size() == mirror.size());
+    }
+    for (std::size_t i = 0; i < mirror.size(); i++) {
+        assert(list.at(i) == mirror[i]);
+    }
+    std::printf("%s: ok\n", name);
+}
+
+template<typename List>
+void bench(const char* name, std::size_t n) {
+    List list;
+    for (std::size_t i = 0; i < n; i++) {
+        list.push_back(static_cast<int>(i));
+    }
+    std::vector<std::size_t> random(n);
+    std::mt19937 rng(1);
+    for (auto& index : random) {
+        index = rng() % n;
+    }
+    const char* patterns[] = {"sequencial", "passo 8", "aleatorio"};
+    for (int p = 0; p < 3; p++) {
+        // aleatorio continua O(n) por acesso: mede so 1000 acessos
+        std::size_t accesses = p == 2 ? 1000 : n;
+        long long sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t k = 0; k < accesses; k++) {
+            std::size_t index = p == 0 ? k : p == 1 ? (k * 8) % n : random[k];
+            sum += list.at(index);
+        }
+        std::chrono::duration<double, std::nano> took =
+            std::chrono::steady_clock::now() - start;
+        std::printf("%-18s n=%-8zu %-10s %10.1f ns/acesso (%lld)\n", name, n,
+                    patterns[p], took.count() / accesses, sum);
+    }
+}
+
+int main() {
+    check<structures::LinkedList<int>>("LinkedList");
+    check<structures::DoublyCircularList<int>>("DoublyCircularList");
+    // sem o dedo, sequencial e passo 8 custavam O(n) por acesso
+    for (std::size_t n : {10000u, 100000u, 1000000u}) {
+        bench<structures::LinkedList<int>>("LinkedList", n);
+        bench<structures::DoublyCircularList<int>>("DoublyCircularList", n);
+    }
+    return 0;
+}
@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <stdexcept>
+#include <utility>
 
 
 namespace structures {
@@ -44,6 +45,16 @@ class LinkedList {
     std::size_t find(const T& data) const;  // posição do dado
     //! ...
     std::size_t size() const;  // tamanho da lista
+    //! ...
+    void sort();  // ordenar (merge sort, sem copiar dados)
+    //! ...
+    template<typename Compare>
+    void sort(Compare compare);  // ordenar pelo critério 'compare'
+    //! ...
+    void merge(LinkedList<T>&& other);  // intercalar duas listas ordenadas
+    //! ...
+    template<typename Compare>
+    void merge(LinkedList<T>&& other, Compare compare);  // idem, 'compare'
 
  private:
     class Node {  // Elemento (implementação pronta)
@@ -83,16 +94,35 @@ class LinkedList {
     };
 
     Node* before_index(std::size_t index) {  // nó anterior ao 'index'
+        std::size_t target = index > 0 ? index - 1 : 0;
+        if (target == size_ - 1) {
+            return tail;
+        }
+
+        // parte do último nó acessado quando ele não está depois do alvo
         auto it = head;
-        for (auto i = 1u; i < index; ++i) {
+        std::size_t i = 0u;
+        if (finger != nullptr && finger_index <= target) {
+            it = finger;
+            i = finger_index;
+        }
+        for (; i < target; ++i) {
             it = it->next();
         }
+
+        finger = it;
+        finger_index = target;
         return it;
     }
 
+    template<typename Compare>
+    static Node* merge_nodes(Node* left, Node* right, Compare compare);
+
     Node* head{nullptr};
     Node* tail{nullptr};
     std::size_t size_{0u};
+    Node* finger{nullptr};  // último nó acessado por posição
+    std::size_t finger_index{0u};  // índice de 'finger'
 };
 
 }  // namespace structures
@@ -106,6 +136,8 @@ structures::LinkedList<T>::LinkedList() {
     head = nullptr;
     tail = nullptr;
     size_ = 0u;
+    finger = nullptr;
+    finger_index = 0u;
 }
 
 //! Destrutor
@@ -134,6 +166,9 @@ void structures::LinkedList<T>::push_front(const T& data) {
         tail = novo;
     }
     head = novo;
+    if (finger != nullptr) {
+        finger_index++;
+    }
     size_++;
 }
 
@@ -186,6 +221,9 @@ void structures::LinkedList<T>::insert(const T& data, std::size_t index) {
     Node* previous = before_index(index);
     Node* newNode = new Node(data, previous->next());
     previous->next(newNode);
+    if (previous == tail) {
+        tail = newNode;
+    }
 
     size_++;
 }
@@ -222,6 +260,11 @@ T structures::LinkedList<T>::pop_front() {
     p = head;
     head = p->next();
     aux = p->data();
+    if (finger == p) {
+        finger = nullptr;
+    } else if (finger != nullptr) {
+        finger_index--;
+    }
     delete p;
     if (head == nullptr) {
         tail = nullptr;
@@ -248,6 +291,9 @@ T structures::LinkedList<T>::pop_back() {
         p = p->next();
     }
     aux = p->data();
+    if (finger == p) {
+        finger = nullptr;
+    }
     delete p;
     if (ant == nullptr) {
         head = nullptr;
@@ -277,6 +323,9 @@ T structures::LinkedList<T>::pop(std::size_t index) {
     Node* previous = before_index(index);
     Node* toDelete = previous->next();
     previous->next(toDelete->next());
+    if (toDelete == tail) {
+        tail = previous;
+    }
     T data = toDelete->data();
     delete toDelete;
 
@@ -330,3 +379,104 @@ std::size_t structures::LinkedList<T>::size() const {
     return size_;
 }
 
+//! Intercala duas sequências ordenadas de nós (estável: 'left' primeiro)
+template<typename T>
+template<typename Compare>
+typename structures::LinkedList<T>::Node*
+structures::LinkedList<T>::merge_nodes(Node* left, Node* right,
+                                       Compare compare) {
+    Node* first = nullptr;
+    Node* last = nullptr;
+    while (left != nullptr && right != nullptr) {
+        Node* next;
+        if (compare(right->data(), left->data())) {
+            next = right;
+            right = right->next();
+        } else {
+            next = left;
+            left = left->next();
+        }
+        if (last == nullptr) {
+            first = next;
+        } else {
+            last->next(next);
+        }
+        last = next;
+    }
+
+    Node* rest = left != nullptr ? left : right;
+    if (last == nullptr) {
+        return rest;
+    }
+    last->next(rest);
+    return first;
+}
+
+//! Ordenação crescente
+template<typename T>
+void structures::LinkedList<T>::sort() {
+    sort([](const T& a, const T& b) { return a < b; });
+}
+
+//! Ordenação por merge sort bottom-up, religando os nós
+template<typename T>
+template<typename Compare>
+void structures::LinkedList<T>::sort(Compare compare) {
+    // bins[i] guarda uma sublista ordenada de 2^i nós (ou nullptr)
+    Node* bins[64] = {};
+    Node* current = head;
+    while (current != nullptr) {
+        Node* node = current;
+        current = current->next();
+        node->next(nullptr);
+
+        std::size_t i = 0;
+        for (; bins[i] != nullptr; i++) {
+            node = merge_nodes(bins[i], node, compare);
+            bins[i] = nullptr;
+        }
+        bins[i] = node;
+    }
+
+    Node* sorted = nullptr;
+    for (std::size_t i = 0; i < 64; i++) {
+        if (bins[i] != nullptr) {
+            sorted = merge_nodes(bins[i], sorted, compare);
+        }
+    }
+
+    head = sorted;
+    tail = sorted;
+    while (tail != nullptr && tail->next() != nullptr) {
+        tail = tail->next();
+    }
+    finger = nullptr;
+}
+
+//! Intercalação com outra lista ordenada (que fica vazia)
+template<typename T>
+void structures::LinkedList<T>::merge(LinkedList<T>&& other) {
+    merge(std::move(other), [](const T& a, const T& b) { return a < b; });
+}
+
+//! Intercalação com outra lista ordenada por 'compare'
+template<typename T>
+template<typename Compare>
+void structures::LinkedList<T>::merge(LinkedList<T>&& other,
+                                      Compare compare) {
+    if (&other == this || other.empty()) {
+        return;
+    }
+
+    head = merge_nodes(head, other.head, compare);
+    if (tail == nullptr || !compare(other.tail->data(), tail->data())) {
+        tail = other.tail;
+    }
+    size_ += other.size_;
+    finger = nullptr;
+
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.size_ = 0u;
+    other.finger = nullptr;
+}
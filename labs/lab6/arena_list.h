@@ -0,0 +1,414 @@
+//! Copyright [2024] <Luan da Silva Moraes>
+#ifndef STRUCTURES_ARENA_LIST_H
+#define STRUCTURES_ARENA_LIST_H
+
+#include <cstdint>  // std::size_t, std::uint32_t
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move
+
+namespace structures {
+
+template<typename T>
+//! Classe ArenaList
+/*!
+    Lista duplamente encadeada com a mesma interface da DoublyLinkedList,
+    mas com todos os nós em um único vetor contíguo e ligações de 32 bits
+    (índices no vetor) no lugar de ponteiros. Para T = int cada nó ocupa
+    12 bytes, contra 24 bytes (mais o cabeçalho do malloc) de um nó
+    alocado individualmente. Posições liberadas são reaproveitadas por uma
+    lista de livres.
+*/
+class ArenaList {
+ public:
+    //! indice que representa "nenhum no"
+    static const std::uint32_t NIL = 0xFFFFFFFFu;
+
+    ArenaList();
+    explicit ArenaList(std::size_t capacity);
+    ~ArenaList();
+    ArenaList(const ArenaList&) = delete;
+    ArenaList& operator=(const ArenaList&) = delete;
+    //! metodo limpar dados
+    void clear();
+    //! metodo inserir no fim
+    void push_back(const T& data);
+    //! metodo inserir no inicio
+    void push_front(const T& data);
+    //! metodo inserir no indice
+    void insert(const T& data, std::size_t index);
+    //! metodo inserir ordenado
+    void insert_sorted(const T& data);
+    //! metodo remover indice
+    T pop(std::size_t index);
+    //! metodo remover fim
+    T pop_back();
+    //! metodo remover inicio
+    T pop_front();
+    //! metodo remover primeiro que contem
+    void remove(const T& data);
+    //! metodo esta vazio
+    bool empty() const;
+    //! metodo contem
+    bool contains(const T& data) const;
+    //! metodo retornar no indice
+    T& at(std::size_t index);
+    //! metodo retornar no indice
+    const T& at(std::size_t index) const;
+    //! metodo encontrar dado
+    std::size_t find(const T& data) const;
+    //! metodo retornar tamanho
+    std::size_t size() const;
+
+    //! metodo reserva espaco para 'capacity' nos
+    void reserve(std::size_t capacity);
+    //! metodo retorna quantos nos cabem sem realocar
+    std::size_t capacity() const;
+    //! metodo retorna os bytes ocupados pela lista (arena inclusa)
+    std::size_t memory_usage() const;
+    //! metodo retorna os bytes ocupados por um no
+    static constexpr std::size_t node_size() {
+        return sizeof(Node);
+    }
+
+    //! percurso: primeiro no (NIL se vazia)
+    std::uint32_t first() const;
+    //! percurso: ultimo no (NIL se vazia)
+    std::uint32_t last() const;
+    //! percurso: proximo no (NIL no fim)
+    std::uint32_t next(std::uint32_t node) const;
+    //! percurso: no anterior (NIL no inicio)
+    std::uint32_t prev(std::uint32_t node) const;
+    //! percurso: dado do no
+    T& value(std::uint32_t node);
+    //! percurso: dado do no
+    const T& value(std::uint32_t node) const;
+
+ private:
+    struct Node {
+        T data;
+        std::uint32_t prev;
+        std::uint32_t next;
+    };
+
+    //! obtem um no livre (da lista de livres ou do fim da arena)
+    std::uint32_t allocate(const T& data);
+    //! devolve um no para a lista de livres
+    void release(std::uint32_t node);
+    //! encadeia 'node' antes de 'position' (NIL = no fim)
+    void link_before(std::uint32_t position, std::uint32_t node);
+    //! desencadeia 'node' e retorna o seu dado
+    T unlink(std::uint32_t node);
+
+    //! posicionamento pelo caminho mais curto
+    std::uint32_t posicao(std::size_t index) const {
+        std::uint32_t p;
+        if (index < size()/2) {  // do início para o fim
+            p = head;
+            for (std::size_t i = 0; i < index; i++) {
+                p = nodes[p].next;
+            }
+        } else {  // do fim para o início
+            p = tail;
+            for (std::size_t i = size()-1; i > index; i--) {
+                p = nodes[p].prev;
+            }
+        }
+        return p;
+    }
+
+    //! arena de nos
+    Node* nodes;
+    //! primeiro da lista
+    std::uint32_t head;
+    //! ultimo da lista
+    std::uint32_t tail;
+    //! primeiro no livre (encadeado por 'next')
+    std::uint32_t free_;
+    //! nos ja usados alguma vez (o restante da arena nunca foi tocado)
+    std::uint32_t used_;
+    //! capacidade da arena
+    std::uint32_t capacity_;
+    //! tamanho
+    std::uint32_t size_;
+
+    static const auto DEFAULT_CAPACITY = 16u;
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::ArenaList<T>::ArenaList():
+    ArenaList(DEFAULT_CAPACITY)
+{}
+
+template<typename T>
+structures::ArenaList<T>::ArenaList(std::size_t capacity) {
+    if (capacity == 0) {
+        capacity = DEFAULT_CAPACITY;
+    }
+    if (capacity >= NIL) {
+        throw std::out_of_range("capacidade excede indices de 32 bits");
+    }
+    nodes = new Node[capacity];
+    capacity_ = static_cast<std::uint32_t>(capacity);
+    head = NIL;
+    tail = NIL;
+    free_ = NIL;
+    used_ = 0;
+    size_ = 0;
+}
+
+template<typename T>
+structures::ArenaList<T>::~ArenaList() {
+    delete[] nodes;
+}
+
+template<typename T>
+void structures::ArenaList<T>::clear() {
+    // libera agora o que os dados possuem, sem esperar a posicao ser reusada
+    for (std::uint32_t p = head; p != NIL; p = nodes[p].next) {
+        nodes[p].data = T();
+    }
+    head = NIL;
+    tail = NIL;
+    free_ = NIL;
+    used_ = 0;
+    size_ = 0;
+}
+
+template<typename T>
+void structures::ArenaList<T>::reserve(std::size_t capacity) {
+    if (capacity <= capacity_) {
+        return;
+    }
+    if (capacity >= NIL) {
+        throw std::out_of_range("capacidade excede indices de 32 bits");
+    }
+    Node* bigger = new Node[capacity];
+    for (std::uint32_t i = 0; i < used_; i++) {
+        bigger[i].data = std::move(nodes[i].data);
+        bigger[i].prev = nodes[i].prev;
+        bigger[i].next = nodes[i].next;
+    }
+    delete[] nodes;
+    nodes = bigger;
+    capacity_ = static_cast<std::uint32_t>(capacity);
+}
+
+template<typename T>
+std::uint32_t structures::ArenaList<T>::allocate(const T& data) {
+    std::uint32_t node;
+    if (free_ != NIL) {
+        node = free_;
+        free_ = nodes[node].next;
+    } else {
+        if (used_ == capacity_) {
+            if (capacity_ == NIL - 1) {  // todos os indices ja usados
+                throw std::out_of_range("arena cheia");
+            }
+            // 'data' pode estar dentro da arena que vai ser realocada
+            T copy = data;
+            std::size_t doubled = 2 * static_cast<std::size_t>(capacity_);
+            reserve(doubled < NIL ? doubled : NIL - 1);
+            node = used_++;
+            nodes[node].data = std::move(copy);
+            return node;
+        }
+        node = used_++;
+    }
+    nodes[node].data = data;
+    return node;
+}
+
+template<typename T>
+void structures::ArenaList<T>::release(std::uint32_t node) {
+    nodes[node].next = free_;
+    free_ = node;
+}
+
+template<typename T>
+void structures::ArenaList<T>::link_before(std::uint32_t position,
+                                           std::uint32_t node) {
+    std::uint32_t before = position == NIL ? tail : nodes[position].prev;
+    nodes[node].prev = before;
+    nodes[node].next = position;
+    if (before == NIL) {
+        head = node;
+    } else {
+        nodes[before].next = node;
+    }
+    if (position == NIL) {
+        tail = node;
+    } else {
+        nodes[position].prev = node;
+    }
+    size_++;
+}
+
+template<typename T>
+T structures::ArenaList<T>::unlink(std::uint32_t node) {
+    std::uint32_t before = nodes[node].prev;
+    std::uint32_t after = nodes[node].next;
+    if (before == NIL) {
+        head = after;
+    } else {
+        nodes[before].next = after;
+    }
+    if (after == NIL) {
+        tail = before;
+    } else {
+        nodes[after].prev = before;
+    }
+    size_--;
+    T data = std::move(nodes[node].data);
+    release(node);
+    return data;
+}
+
+template<typename T>
+void structures::ArenaList<T>::push_back(const T& data) {
+    link_before(NIL, allocate(data));
+}
+
+template<typename T>
+void structures::ArenaList<T>::push_front(const T& data) {
+    link_before(head, allocate(data));
+}
+
+template<typename T>
+void structures::ArenaList<T>::insert(const T& data, std::size_t index) {
+    if (index > size()) {
+        throw std::out_of_range("indice inexistente");
+    }
+    std::uint32_t node = allocate(data);
+    link_before(index == size() ? NIL : posicao(index), node);
+}
+
+template<typename T>
+void structures::ArenaList<T>::insert_sorted(const T& data) {
+    std::uint32_t p = head;
+    while (p != NIL && nodes[p].data < data) {
+        p = nodes[p].next;
+    }
+    link_before(p, allocate(data));
+}
+
+template<typename T>
+T structures::ArenaList<T>::pop(std::size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("indice inexistente");
+    }
+    return unlink(posicao(index));
+}
+
+template<typename T>
+T structures::ArenaList<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    return unlink(tail);
+}
+
+template<typename T>
+T structures::ArenaList<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    return unlink(head);
+}
+
+template<typename T>
+void structures::ArenaList<T>::remove(const T& data) {
+    std::uint32_t p = head;
+    while (p != NIL && nodes[p].data != data) {
+        p = nodes[p].next;
+    }
+    if (p != NIL) {
+        unlink(p);
+    }
+}
+
+template<typename T>
+bool structures::ArenaList<T>::empty() const {
+    return size() == 0;
+}
+
+template<typename T>
+bool structures::ArenaList<T>::contains(const T& data) const {
+    return find(data) != size();
+}
+
+template<typename T>
+T& structures::ArenaList<T>::at(std::size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("indice inexistente");
+    }
+    return nodes[posicao(index)].data;
+}
+
+template<typename T>
+const T& structures::ArenaList<T>::at(std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("indice inexistente");
+    }
+    return nodes[posicao(index)].data;
+}
+
+template<typename T>
+std::size_t structures::ArenaList<T>::find(const T& data) const {
+    std::size_t i = 0;
+    for (std::uint32_t p = head; p != NIL; p = nodes[p].next) {
+        if (nodes[p].data == data) {
+            return i;
+        }
+        i++;
+    }
+    return size();
+}
+
+template<typename T>
+std::size_t structures::ArenaList<T>::size() const {
+    return size_;
+}
+
+template<typename T>
+std::size_t structures::ArenaList<T>::capacity() const {
+    return capacity_;
+}
+
+template<typename T>
+std::size_t structures::ArenaList<T>::memory_usage() const {
+    return sizeof(*this) + capacity() * node_size();
+}
+
+template<typename T>
+std::uint32_t structures::ArenaList<T>::first() const {
+    return head;
+}
+
+template<typename T>
+std::uint32_t structures::ArenaList<T>::last() const {
+    return tail;
+}
+
+template<typename T>
+std::uint32_t structures::ArenaList<T>::next(std::uint32_t node) const {
+    return nodes[node].next;
+}
+
+template<typename T>
+std::uint32_t structures::ArenaList<T>::prev(std::uint32_t node) const {
+    return nodes[node].prev;
+}
+
+template<typename T>
+T& structures::ArenaList<T>::value(std::uint32_t node) {
+    return nodes[node].data;
+}
+
+template<typename T>
+const T& structures::ArenaList<T>::value(std::uint32_t node) const {
+    return nodes[node].data;
+}
+
+#endif
@@ -0,0 +1,170 @@
+// Copyright [2024] <Luan da Silva Moraes>
+//! ArenaList e IntrusiveList contra a DoublyLinkedList: confere as
+//! operacoes com um std::list, informa bytes por elemento e mede o
+//! percurso completo (find de um valor ausente).
+//!
+//!     g++ -std=c++17 -O2 bench_compact_lists.cpp -o bench_compact_lists
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./arena_list.h"
+#include "./doubly_linked_list.h"
+#include "./intrusive_list.h"
+
+struct Item : structures::IntrusiveListHook {
+    int value;
+};
+
+void check_arena() {
+    std::mt19937 rng(27);
+    structures::ArenaList<int> list(1);
+    std::list<int> mirror;
+    for (int op = 0; op < 50000; op++) {
+        std::size_t size = mirror.size();
+        int kind = rng() % 5;
+        if (kind < 2 || size == 0) {
+            std::size_t index = rng() % (size + 1);
+            list.insert(op, index);
+            mirror.insert(std::next(mirror.begin(), index), op);
+        } else if (kind == 2) {
+            std::size_t index = rng() % size;
+            auto it = std::next(mirror.begin(), index);
+            assert(list.pop(index) == *it);
+            mirror.erase(it);
+        } else if (kind == 3) {
+            list.insert_sorted(op);
+            mirror.insert(std::next(mirror.begin(), list.find(op)), op);
+        } else {
+            std::size_t index = rng() % size;
+            assert(list.at(index) == *std::next(mirror.begin(), index));
+        }
+        assert(list.size() == mirror.size());
+        if (op % 10000 == 9999) {
+            std::uint32_t node = list.first();
+            for (int value : mirror) {
+                assert(list.value(node) == value);
+                node = list.next(node);
+            }
+            assert(node == list.NIL);
+        }
+    }
+    // clear() solta o que os dados possuem
+    structures::ArenaList<std::string> strings;
+    strings.push_back(std::string(1000, 'x'));
+    std::string& kept = strings.at(0);
+    strings.clear();
+    assert(kept.empty() && strings.empty());
+    std::printf("ArenaList: ok\n");
+}
+
+void check_intrusive() {
+    std::vector<Item> items(100);
+    structures::IntrusiveList<Item> list;
+    std::list<Item*> mirror;
+    std::mt19937 rng(7);
+    for (int op = 0; op < 20000; op++) {
+        Item& item = items[rng() % items.size()];
+        if (item.linked()) {
+            list.remove(item);
+            mirror.remove(&item);
+        } else if (rng() % 2) {
+            list.push_back(item);
+            mirror.push_back(&item);
+        } else {
+            list.push_front(item);
+            mirror.push_front(&item);
+        }
+        assert(list.size() == mirror.size());
+    }
+    Item* p = list.empty() ? nullptr : &list.front();
+    for (Item* expected : mirror) {
+        assert(p == expected);
+        p = list.next(*p);
+    }
+    assert(p == nullptr);
+    list.clear();
+    for (const Item& item : items) {
+        assert(!item.linked());
+    }
+    std::printf("IntrusiveList: ok\n");
+}
+
+template<typename Work>
+double seconds(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+    return took.count();
+}
+
+void bench(std::size_t n) {
+    structures::DoublyLinkedList<int> pointers;
+    structures::ArenaList<int> arena;
+    std::vector<Item> items(n);
+    structures::IntrusiveList<Item> intrusive;
+    double build[3];
+    build[0] = seconds([&] {
+        for (std::size_t i = 0; i < n; i++) {
+            pointers.push_back(static_cast<int>(i));
+        }
+    });
+    build[1] = seconds([&] {
+        for (std::size_t i = 0; i < n; i++) {
+            arena.push_back(static_cast<int>(i));
+        }
+    });
+    build[2] = seconds([&] {
+        for (std::size_t i = 0; i < n; i++) {
+            items[i].value = static_cast<int>(i);
+            intrusive.push_back(items[i]);
+        }
+    });
+    std::size_t found[3];
+    double walk[3];
+    walk[0] = seconds([&] { found[0] = pointers.find(-1); });
+    walk[1] = seconds([&] { found[1] = arena.find(-1); });
+    walk[2] = seconds([&] {
+        std::size_t i = 0;
+        for (Item* p = &intrusive.front(); p != nullptr;
+             p = intrusive.next(*p)) {
+            if (p->value == -1) {
+                break;
+            }
+            i++;
+        }
+        found[2] = i;
+    });
+    assert(found[0] == n && found[1] == n && found[2] == n);
+    // no com dado e dois ponteiros; o malloc do glibc soma 8 bytes de
+    // cabecalho e arredonda para multiplo de 16
+    std::size_t pointer_node = (sizeof(int) + 7) / 8 * 8 + 2 * sizeof(void*);
+    pointer_node = (pointer_node + 8 + 15) / 16 * 16;
+    std::printf("n=%zu\n", n);
+    std::printf("  DoublyLinkedList  ~%2zu B/elem  push_back %6.1f ns"
+                "  percurso %5.2f ns/elem\n", pointer_node,
+                build[0] / n * 1e9, walk[0] / n * 1e9);
+    std::printf("  ArenaList         %5.1f B/elem  push_back %6.1f ns"
+                "  percurso %5.2f ns/elem\n",
+                static_cast<double>(arena.memory_usage()) / n,
+                build[1] / n * 1e9, walk[1] / n * 1e9);
+    std::printf("  IntrusiveList     %3zu B/gancho  push_back %6.1f ns"
+                "  percurso %5.2f ns/elem\n",
+                sizeof(structures::IntrusiveListHook),
+                build[2] / n * 1e9, walk[2] / n * 1e9);
+}
+
+int main() {
+    check_arena();
+    check_intrusive();
+    for (std::size_t n : {100000u, 1000000u, 10000000u}) {
+        bench(n);
+    }
+    return 0;
+}
@@ -1,6 +1,7 @@
 //! Copyright [year] <Luan da Silva Moraes>
 
 #include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move
 
 namespace structures {
 
@@ -40,6 +41,16 @@ class DoublyLinkedList {
     std::size_t find(const T& data) const;  // posição de um dado
     //! metodo retornar tamanho
     std::size_t size() const;  // tamanho
+    //! metodo ordenar (merge sort, sem copiar dados)
+    void sort();
+    //! metodo ordenar pelo criterio 'compare'
+    template<typename Compare>
+    void sort(Compare compare);
+    //! metodo intercalar com outra lista ordenada
+    void merge(DoublyLinkedList<T>&& other);
+    //! metodo intercalar com outra lista ordenada por 'compare'
+    template<typename Compare>
+    void merge(DoublyLinkedList<T>&& other, Compare compare);
 
  private:
     class Node {
@@ -94,8 +105,8 @@ class DoublyLinkedList {
 
      private:
         T data_;
-        Node* prev_;
-        Node* next_;
+        Node* prev_{nullptr};
+        Node* next_{nullptr};
     };
 
     //! posicionamento do ponteiro pelo caminho mais curto
@@ -115,6 +126,20 @@ class DoublyLinkedList {
         return p;
     }
 
+    //! intercala duas sequencias ordenadas encadeadas por 'next'
+    template<typename Compare>
+    static Node* merge_nodes(Node* left, Node* right, Compare compare);
+
+    //! refaz 'prev' e 'tail' a partir do encadeamento por 'next'
+    void relink_prev() {
+        Node *ant = nullptr;
+        for (Node *p = head; p != nullptr; p = p->next()) {
+            p->prev(ant);
+            ant = p;
+        }
+        tail = ant;
+    }
+
     //! ponteiro de inicio
     Node* head;  // primeiro da lista
     //! ponteiro de fim
@@ -350,3 +375,95 @@ std::size_t structures::DoublyLinkedList<T>::size() const {
 	return size_;
 }
 
+template<typename T>
+template<typename Compare>
+typename structures::DoublyLinkedList<T>::Node*
+structures::DoublyLinkedList<T>::merge_nodes(Node* left, Node* right,
+                                             Compare compare) {
+    Node *first = nullptr;
+    Node *last = nullptr;
+    while (left != nullptr && right != nullptr) {
+        Node *p;
+        if (compare(right->data(), left->data())) {
+            p = right;
+            right = right->next();
+        } else {  // estavel: empate fica com 'left'
+            p = left;
+            left = left->next();
+        }
+        if (last == nullptr) {
+            first = p;
+        } else {
+            last->next(p);
+        }
+        last = p;
+    }
+
+    Node *rest = left != nullptr ? left : right;
+    if (last == nullptr) {
+        return rest;
+    }
+    last->next(rest);
+    return first;
+}
+
+template<typename T>
+void structures::DoublyLinkedList<T>::sort() {
+    sort([](const T& a, const T& b) { return a < b; });
+}
+
+template<typename T>
+template<typename Compare>
+void structures::DoublyLinkedList<T>::sort(Compare compare) {
+    if (size_ < 2) {
+        return;
+    }
+
+    // merge sort bottom-up: bins[i] guarda uma sublista de 2^i nos
+    Node *bins[64] = {};
+    Node *p = head;
+    while (p != nullptr) {
+        Node *node = p;
+        p = p->next();
+        node->next(nullptr);
+
+        std::size_t i = 0;
+        for (; bins[i] != nullptr; i++) {
+            node = merge_nodes(bins[i], node, compare);
+            bins[i] = nullptr;
+        }
+        bins[i] = node;
+    }
+
+    Node *sorted = nullptr;
+    for (std::size_t i = 0; i < 64; i++) {
+        if (bins[i] != nullptr) {
+            sorted = merge_nodes(bins[i], sorted, compare);
+        }
+    }
+
+    head = sorted;
+    relink_prev();
+}
+
+template<typename T>
+void structures::DoublyLinkedList<T>::merge(DoublyLinkedList<T>&& other) {
+    merge(std::move(other), [](const T& a, const T& b) { return a < b; });
+}
+
+template<typename T>
+template<typename Compare>
+void structures::DoublyLinkedList<T>::merge(DoublyLinkedList<T>&& other,
+                                            Compare compare) {
+    if (&other == this || other.empty()) {
+        return;
+    }
+
+    head = merge_nodes(head, other.head, compare);
+    relink_prev();
+    size_ += other.size_;
+
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.size_ = 0;
+}
@@ -0,0 +1,251 @@
+//! Copyright [2024] <Luan da Silva Moraes>
+#ifndef STRUCTURES_INTRUSIVE_LIST_H
+#define STRUCTURES_INTRUSIVE_LIST_H
+
+#include <cassert>  // assert
+#include <cstdint>  // std::size_t
+#include <stdexcept>  // C++ exceptions
+
+namespace structures {
+
+//! Gancho embutido nos objetos guardados numa IntrusiveList
+/*!
+    O tipo do usuário deriva de IntrusiveListHook; os ponteiros do
+    encadeamento ficam dentro do próprio objeto, então inserir e remover
+    não alocam memória. Um objeto participa de no máximo uma lista.
+*/
+class IntrusiveListHook {
+ public:
+    IntrusiveListHook() = default;
+    //! copiar um objeto não copia a sua posição em uma lista
+    IntrusiveListHook(const IntrusiveListHook&) {}
+    //! atribuir a um objeto não altera a sua posição em uma lista
+    IntrusiveListHook& operator=(const IntrusiveListHook&) {
+        return *this;
+    }
+    //! metodo verifica se o objeto esta em uma lista
+    bool linked() const {
+        return next_ != nullptr;
+    }
+
+ private:
+    template<typename> friend class IntrusiveList;
+
+    IntrusiveListHook* prev_{nullptr};
+    IntrusiveListHook* next_{nullptr};
+};
+
+template<typename T>
+//! Classe IntrusiveList
+/*!
+    Lista duplamente encadeada que não possui os seus elementos: ela apenas
+    encadeia objetos que já pertencem a outra estrutura (T deriva de
+    IntrusiveListHook). Os objetos devem continuar vivos enquanto estiverem
+    na lista; destruir a lista apenas os desencadeia.
+*/
+class IntrusiveList {
+ public:
+    IntrusiveList();
+    ~IntrusiveList();
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+    /*
+        'position' em insert_before e 'object' em remove precisam estar
+        nesta lista: o gancho não sabe a que lista pertence, e passar um
+        objeto de outra lista corromperia as duas. Com NDEBUG desligado,
+        isso é conferido (percorrendo a lista).
+    */
+    //! metodo desencadeia todos os objetos
+    void clear();
+    //! metodo encadeia no fim
+    void push_back(T& object);
+    //! metodo encadeia no inicio
+    void push_front(T& object);
+    //! metodo encadeia antes de 'position' (que ja esta na lista)
+    void insert_before(T& position, T& object);
+    //! metodo desencadeia o ultimo
+    T& pop_back();
+    //! metodo desencadeia o primeiro
+    T& pop_front();
+    //! metodo desencadeia um objeto especifico em O(1)
+    void remove(T& object);
+    //! metodo retorna o primeiro
+    T& front();
+    //! metodo retorna o ultimo
+    T& back();
+    //! metodo retorna o proximo de 'object' (nullptr no fim)
+    T* next(T& object);
+    //! metodo retorna o anterior de 'object' (nullptr no inicio)
+    T* prev(T& object);
+    //! metodo esta vazio
+    bool empty() const;
+    //! metodo contem (percorre a lista)
+    bool contains(const T& object) const;
+    //! metodo retornar tamanho
+    std::size_t size() const;
+
+ private:
+    //! objeto que contem o gancho
+    static T& owner(IntrusiveListHook* hook) {
+        return static_cast<T&>(*hook);
+    }
+
+    //! encadeia 'hook' antes de 'position'
+    void link(IntrusiveListHook* position, IntrusiveListHook* hook);
+    //! desencadeia 'hook'
+    void unlink(IntrusiveListHook* hook);
+
+    //! sentinela da lista circular (sentinel.next_ e o primeiro)
+    IntrusiveListHook sentinel;
+    //! tamanho
+    std::size_t size_;
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::IntrusiveList<T>::IntrusiveList() {
+    sentinel.prev_ = &sentinel;
+    sentinel.next_ = &sentinel;
+    size_ = 0;
+}
+
+template<typename T>
+structures::IntrusiveList<T>::~IntrusiveList() {
+    clear();
+}
+
+template<typename T>
+void structures::IntrusiveList<T>::link(IntrusiveListHook* position,
+                                        IntrusiveListHook* hook) {
+    if (hook->linked()) {
+        throw std::out_of_range("objeto ja esta em uma lista");
+    }
+    hook->prev_ = position->prev_;
+    hook->next_ = position;
+    position->prev_->next_ = hook;
+    position->prev_ = hook;
+    size_++;
+}
+
+template<typename T>
+void structures::IntrusiveList<T>::unlink(IntrusiveListHook* hook) {
+    hook->prev_->next_ = hook->next_;
+    hook->next_->prev_ = hook->prev_;
+    hook->prev_ = nullptr;
+    hook->next_ = nullptr;
+    size_--;
+}
+
+template<typename T>
+void structures::IntrusiveList<T>::clear() {
+    while (!empty()) {
+        unlink(sentinel.next_);
+    }
+}
+
+template<typename T>
+void structures::IntrusiveList<T>::push_back(T& object) {
+    link(&sentinel, &object);
+}
+
+template<typename T>
+void structures::IntrusiveList<T>::push_front(T& object) {
+    link(sentinel.next_, &object);
+}
+
+template<typename T>
+void structures::IntrusiveList<T>::insert_before(T& position, T& object) {
+    if (!position.linked()) {
+        throw std::out_of_range("posicao fora da lista");
+    }
+    assert(contains(position) && "posicao pertence a outra lista");
+    link(&position, &object);
+}
+
+template<typename T>
+T& structures::IntrusiveList<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    IntrusiveListHook* hook = sentinel.prev_;
+    unlink(hook);
+    return owner(hook);
+}
+
+template<typename T>
+T& structures::IntrusiveList<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    IntrusiveListHook* hook = sentinel.next_;
+    unlink(hook);
+    return owner(hook);
+}
+
+template<typename T>
+void structures::IntrusiveList<T>::remove(T& object) {
+    if (!object.linked()) {
+        throw std::out_of_range("objeto fora da lista");
+    }
+    assert(contains(object) && "objeto pertence a outra lista");
+    unlink(&object);
+}
+
+template<typename T>
+T& structures::IntrusiveList<T>::front() {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    return owner(sentinel.next_);
+}
+
+template<typename T>
+T& structures::IntrusiveList<T>::back() {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    return owner(sentinel.prev_);
+}
+
+template<typename T>
+T* structures::IntrusiveList<T>::next(T& object) {
+    IntrusiveListHook* hook = static_cast<IntrusiveListHook&>(object).next_;
+    if (hook == &sentinel || hook == nullptr) {
+        return nullptr;
+    }
+    return &owner(hook);
+}
+
+template<typename T>
+T* structures::IntrusiveList<T>::prev(T& object) {
+    IntrusiveListHook* hook = static_cast<IntrusiveListHook&>(object).prev_;
+    if (hook == &sentinel || hook == nullptr) {
+        return nullptr;
+    }
+    return &owner(hook);
+}
+
+template<typename T>
+bool structures::IntrusiveList<T>::empty() const {
+    return size() == 0;
+}
+
+template<typename T>
+bool structures::IntrusiveList<T>::contains(const T& object) const {
+    const IntrusiveListHook* hook = sentinel.next_;
+    while (hook != &sentinel) {
+        if (hook == &object) {
+            return true;
+        }
+        hook = hook->next_;
+    }
+    return false;
+}
+
+template<typename T>
+std::size_t structures::IntrusiveList<T>::size() const {
+    return size_;
+}
+
+#endif
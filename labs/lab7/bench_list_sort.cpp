@@ -0,0 +1,115 @@
+// Copyright [2022] <Luan da Silva Moraes>
+//! sort() e merge() de LinkedList, DoublyLinkedList e DoublyCircularList:
+//! confere com std::stable_sort/std::merge e compara o tempo de ordenar
+//! contra montar a lista com insert_sorted (O(n^2): so com n <= 20K).
+//!
+//!     g++ -std=c++17 -O2 bench_list_sort.cpp -o bench_list_sort
+//!     ./bench_list_sort [n maximo, padrao 1000000; ex.: 10000000]
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../lab5/linked_list.h"
+#include "../lab6/doubly_linked_list.h"
+#include "./doubly_circular_list.h"
+
+template<typename List>
+std::vector<int> contents(List& list) {
+    std::vector<int> out;
+    while (!list.empty()) {
+        out.push_back(list.pop_front());
+    }
+    return out;
+}
+
+template<typename List>
+void check(const char* name) {
+    std::mt19937 rng(28);
+    for (int round = 0; round < 200; round++) {
+        std::size_t n = rng() % 300;
+        std::vector<std::pair<int, int>> values(n);
+        for (std::size_t i = 0; i < n; i++) {
+            values[i] = {static_cast<int>(rng() % 20), static_cast<int>(i)};
+        }
+        // estabilidade: ordena pela chave, empates na ordem original
+        List keyed;
+        for (auto& v : values) {
+            keyed.push_back(v.first * 1000 + v.second);
+        }
+        keyed.sort([](int a, int b) { return a / 1000 < b / 1000; });
+        std::vector<int> expected;
+        for (auto& v : values) {
+            expected.push_back(v.first * 1000 + v.second);
+        }
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](int a, int b) { return a / 1000 < b / 1000; });
+        assert(contents(keyed) == expected);
+
+        List a, b;
+        std::vector<int> va, vb;
+        for (std::size_t i = 0; i < n; i++) {
+            int v = static_cast<int>(rng() % 100);
+            (i % 2 ? a : b).push_back(v);
+            (i % 2 ? va : vb).push_back(v);
+        }
+        a.sort();
+        b.sort();
+        a.merge(std::move(b));
+        std::sort(va.begin(), va.end());
+        std::sort(vb.begin(), vb.end());
+        std::vector<int> merged(va.size() + vb.size());
+        std::merge(va.begin(), va.end(), vb.begin(), vb.end(),
+                   merged.begin());
+        assert(b.empty() && a.size() == merged.size());
+        assert(contents(a) == merged);
+    }
+    std::printf("%s: ok\n", name);
+}
+
+template<typename List>
+void bench(const char* name, std::size_t n) {
+    std::vector<int> values(n);
+    std::mt19937 rng(1);
+    for (auto& v : values) {
+        v = static_cast<int>(rng());
+    }
+    List list;
+    for (int v : values) {
+        list.push_back(v);
+    }
+    auto start = std::chrono::steady_clock::now();
+    list.sort();
+    std::chrono::duration<double> sort = std::chrono::steady_clock::now() -
+                                         start;
+    std::printf("%-18s n=%-9zu sort %9.4f s", name, n, sort.count());
+    if (n <= 20000) {
+        List slow;
+        start = std::chrono::steady_clock::now();
+        for (int v : values) {
+            slow.insert_sorted(v);
+        }
+        std::chrono::duration<double> insert =
+            std::chrono::steady_clock::now() - start;
+        std::printf("  insert_sorted %9.4f s", insert.count());
+    }
+    std::printf("\n");
+}
+
+int main(int argc, char** argv) {
+    std::size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) :
+                                   1000000;
+    check<structures::LinkedList<int>>("LinkedList");
+    check<structures::DoublyLinkedList<int>>("DoublyLinkedList");
+    check<structures::DoublyCircularList<int>>("DoublyCircularList");
+    for (std::size_t n = 10000; n <= max_n; n *= 10) {
+        bench<structures::LinkedList<int>>("LinkedList", n);
+        bench<structures::DoublyLinkedList<int>>("DoublyLinkedList", n);
+        bench<structures::DoublyCircularList<int>>("DoublyCircularList", n);
+    }
+    return 0;
+}
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 
 namespace structures {
 
@@ -138,6 +139,41 @@ class DoublyCircularList {
      */
     std::size_t size() const;
 
+    /**
+     * @brief Ordena a lista em ordem crescente.
+     *
+     * Merge sort bottom-up que religa os nós, sem copiar os dados:
+     * O(n log n) comparações e estável.
+     */
+    void sort();
+
+    /**
+     * @brief Ordena a lista segundo o critério especificado.
+     *
+     * @param compare Retorna true se o primeiro argumento vem antes do
+     * segundo.
+     */
+    template <typename Compare> void sort(Compare compare);
+
+    /**
+     * @brief Intercala outra lista ordenada nesta, que também deve estar
+     * ordenada. A outra lista fica vazia.
+     *
+     * @param other A lista a ser intercalada.
+     */
+    void merge(DoublyCircularList<T>&& other);
+
+    /**
+     * @brief Intercala outra lista ordenada segundo o critério
+     * especificado. A outra lista fica vazia.
+     *
+     * @param other A lista a ser intercalada.
+     * @param compare Retorna true se o primeiro argumento vem antes do
+     * segundo.
+     */
+    template <typename Compare>
+    void merge(DoublyCircularList<T>&& other, Compare compare);
+
  private:
     /**
      * @brief A classe Node representa um nó na lista duplamente encadeada
@@ -233,8 +269,38 @@ class DoublyCircularList {
         Node* next_;  // Um ponteiro para o próximo nó
     };
 
+    /**
+     * @brief Retorna o nó na posição especificada, partindo do ponto de
+     * acesso mais próximo entre a cabeça, a cauda e o último nó acessado.
+     *
+     * @param index A posição do nó (deve ser menor que size()).
+     * @return Um ponteiro para o nó na posição index.
+     */
+    Node* node_at(std::size_t index) const;
+
+    /**
+     * @brief Intercala duas sequências ordenadas de nós encadeadas por
+     * next() e terminadas em nullptr.
+     *
+     * @return O primeiro nó da sequência intercalada.
+     */
+    template <typename Compare>
+    static Node* merge_nodes(Node* left, Node* right, Compare compare);
+
+    /**
+     * @brief Abre o anel: o último nó passa a apontar para nullptr.
+     */
+    void open_ring();
+
+    /**
+     * @brief Refaz os ponteiros prev() a partir de next() e fecha o anel.
+     */
+    void close_ring();
+
     Node* head;         // Um ponteiro para o nó cabeça
     std::size_t size_;  // O número de elementos na lista
+    mutable Node* finger_;               // O último nó acessado por posição
+    mutable std::size_t finger_index_;  // A posição de finger_
 };
 
 }  // namespace structures
@@ -307,6 +373,42 @@ void structures::DoublyCircularList<T>::Node::next(Node* node) {
 template <typename T> structures::DoublyCircularList<T>::DoublyCircularList() {
     head = nullptr;
     size_ = 0;
+    finger_ = nullptr;
+    finger_index_ = 0;
+}
+
+template <typename T>
+typename structures::DoublyCircularList<T>::Node*
+structures::DoublyCircularList<T>::node_at(std::size_t index) const {
+    // distâncias a partir da cabeça (para frente) e da cauda (para trás)
+    Node* current = head;
+    std::size_t from = 0;
+    std::size_t distance = index;
+    if (size_ - 1 - index < distance) {
+        current = head->prev();
+        from = size_ - 1;
+        distance = size_ - 1 - index;
+    }
+    if (finger_ != nullptr) {
+        std::size_t finger_distance = finger_index_ > index
+                                          ? finger_index_ - index
+                                          : index - finger_index_;
+        if (finger_distance < distance) {
+            current = finger_;
+            from = finger_index_;
+        }
+    }
+
+    for (; from < index; from++) {
+        current = current->next();
+    }
+    for (; from > index; from--) {
+        current = current->prev();
+    }
+
+    finger_ = current;
+    finger_index_ = index;
+    return current;
 }
 
 template <typename T> structures::DoublyCircularList<T>::~DoublyCircularList() {
@@ -338,6 +440,9 @@ void structures::DoublyCircularList<T>::push_front(const T& data) {
         head->prev(new_node);
         head = new_node;
     }
+    if (finger_ != nullptr) {
+        finger_index_++;
+    }
     size_++;
 }
 
@@ -350,10 +455,7 @@ void structures::DoublyCircularList<T>::insert(const T& data,
         push_front(data);
     } else {
         Node* new_node = new Node(data);
-        Node* current = head;
-        for (std::size_t i = 0; i < index - 1; i++) {
-            current = current->next();
-        }
+        Node* current = node_at(index - 1);
         new_node->next(current->next());
         new_node->prev(current);
         current->next()->prev(new_node);
@@ -387,10 +489,9 @@ T structures::DoublyCircularList<T>::pop(std::size_t index) {
         return pop_front();
     }
 
-    Node* current = head;
-    for (std::size_t i = 0; i < index; i++) {
-        current = current->next();
-    }
+    Node* current = node_at(index);
+    finger_ = current->prev();
+    finger_index_ = index - 1;
     T data = current->data();
     current->prev()->next(current->next());
     current->next()->prev(current->prev());
@@ -409,6 +510,11 @@ template <typename T> T structures::DoublyCircularList<T>::pop_front() {
     }
 
     Node* current = head;
+    if (finger_ == current) {
+        finger_ = nullptr;
+    } else if (finger_ != nullptr) {
+        finger_index_--;
+    }
     T data = current->data();
     head = current->next();
     head->prev(current->prev());
@@ -438,11 +544,7 @@ T& structures::DoublyCircularList<T>::at(std::size_t index) {
         throw std::out_of_range("Invalid index");
     }
 
-    Node* current = head;
-    for (std::size_t i = 0; i < index; i++) {
-        current = current->next();
-    }
-    return current->data();
+    return node_at(index)->data();
 }
 
 template <typename T>
@@ -451,11 +553,7 @@ const T& structures::DoublyCircularList<T>::at(std::size_t index) const {
         throw std::out_of_range("Invalid index");
     }
 
-    Node* current = head;
-    for (std::size_t i = 0; i < index; i++) {
-        current = current->next();
-    }
-    return current->data();
+    return node_at(index)->data();
 }
 
 template <typename T>
@@ -473,3 +571,118 @@ template <typename T>
 std::size_t structures::DoublyCircularList<T>::size() const {
     return size_;
 }
+
+template <typename T>
+template <typename Compare>
+typename structures::DoublyCircularList<T>::Node*
+structures::DoublyCircularList<T>::merge_nodes(Node* left, Node* right,
+                                               Compare compare) {
+    Node* first = nullptr;
+    Node* last = nullptr;
+    while (left != nullptr && right != nullptr) {
+        Node* current;
+        if (compare(right->data(), left->data())) {
+            current = right;
+            right = right->next();
+        } else {
+            current = left;
+            left = left->next();
+        }
+        if (last == nullptr) {
+            first = current;
+        } else {
+            last->next(current);
+        }
+        last = current;
+    }
+
+    Node* rest = left != nullptr ? left : right;
+    if (last == nullptr) {
+        return rest;
+    }
+    last->next(rest);
+    return first;
+}
+
+template <typename T> void structures::DoublyCircularList<T>::open_ring() {
+    head->prev()->next(nullptr);
+}
+
+template <typename T> void structures::DoublyCircularList<T>::close_ring() {
+    Node* previous = nullptr;
+    for (Node* current = head; current != nullptr; current = current->next()) {
+        current->prev(previous);
+        previous = current;
+    }
+    head->prev(previous);
+    previous->next(head);
+}
+
+template <typename T> void structures::DoublyCircularList<T>::sort() {
+    sort([](const T& a, const T& b) { return a < b; });
+}
+
+template <typename T>
+template <typename Compare>
+void structures::DoublyCircularList<T>::sort(Compare compare) {
+    if (size_ < 2) {
+        return;
+    }
+
+    open_ring();
+
+    // bins[i] guarda uma sublista ordenada de 2^i nós (ou nullptr)
+    Node* bins[64] = {};
+    Node* current = head;
+    while (current != nullptr) {
+        Node* node = current;
+        current = current->next();
+        node->next(nullptr);
+
+        std::size_t i = 0;
+        for (; bins[i] != nullptr; i++) {
+            node = merge_nodes(bins[i], node, compare);
+            bins[i] = nullptr;
+        }
+        bins[i] = node;
+    }
+
+    Node* sorted = nullptr;
+    for (std::size_t i = 0; i < 64; i++) {
+        if (bins[i] != nullptr) {
+            sorted = merge_nodes(bins[i], sorted, compare);
+        }
+    }
+
+    head = sorted;
+    close_ring();
+    finger_ = nullptr;
+}
+
+template <typename T>
+void structures::DoublyCircularList<T>::merge(DoublyCircularList<T>&& other) {
+    merge(std::move(other), [](const T& a, const T& b) { return a < b; });
+}
+
+template <typename T>
+template <typename Compare>
+void structures::DoublyCircularList<T>::merge(DoublyCircularList<T>&& other,
+                                              Compare compare) {
+    if (&other == this || other.empty()) {
+        return;
+    }
+    if (empty()) {
+        head = other.head;
+    } else {
+        open_ring();
+        other.open_ring();
+        head = merge_nodes(head, other.head, compare);
+        close_ring();
+    }
+    size_ += other.size_;
+    finger_ = nullptr;
+
+    other.head = nullptr;
+    other.size_ = 0;
+    other.finger_ = nullptr;
+}